@@ -0,0 +1,46 @@
+#include <parallel.hpp>
+#include <registry.hpp>
+#include <state_summary.hpp>
+#include <utils.hpp>
+
+namespace {
+
+using DialSummary = StateSummary<100>;
+
+static int parse_rotation(const std::string_view data, size_t& pos)
+{
+    const int sign = data[pos] == 'L' ? -1 : 1;
+    ++pos;
+    const int value = parse_uint<int>(data, pos);
+    return sign * value;
+}
+
+// Every rotation shifts the dial, so starting from s the dial is at s + offset after each rotation, where offset is
+// the rotation sum so far. It stops at zero once for each offset congruent to -s, so a histogram of the offsets gives
+// the zero count for all 100 starts in one pass.
+static DialSummary summarize(const std::string_view rotations)
+{
+    std::array<uint64_t, 100> offset_counts {};
+    int offset = 0;
+    for (size_t pos = 0; pos < rotations.length(); ++pos) {
+        offset = math_mod(offset + parse_rotation(rotations, pos), 100);
+        ++offset_counts[offset];
+    }
+    std::array<int, 100> ends {};
+    std::array<uint64_t, 100> zero_counts {};
+    for (int start = 0; start < 100; ++start) {
+        ends[start] = (start + offset) % 100;
+        zero_counts[start] = offset_counts[(100 - start) % 100];
+    }
+    return { ends, zero_counts };
+}
+
+static uint64_t solve(const std::string_view data)
+{
+    const auto then = [](const DialSummary& first, const DialSummary& second) { return first.then(second); };
+    return parallel_scan(data, '\n', summarize, then).back().events(50);
+}
+
+const SolverRegistration registration { 1, 1, solve };
+
+}
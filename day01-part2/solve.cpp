@@ -0,0 +1,65 @@
+#include <parallel.hpp>
+#include <registry.hpp>
+#include <state_summary.hpp>
+#include <utils.hpp>
+
+namespace {
+
+using DialSummary = StateSummary<100>;
+
+static int parse_rotation(const std::string_view data, size_t& pos)
+{
+    const int sign = data[pos] == 'L' ? -1 : 1;
+    ++pos;
+    const int value = parse_uint<int>(data, pos);
+    return sign * value;
+}
+
+// Tracks the dial as an unwrapped position p relative to the start s. A rotation right from p to q passes zero once
+// for each multiple of 100 in (s + p, s + q], which is floor((s + q) / 100) - floor((s + p) / 100); a rotation left
+// counts the multiples in [s + q, s + p), the same expression with p - 1 and q - 1 swapped. For 0 <= s < 100,
+// floor((s + x) / 100) = floor(x / 100) + (x mod 100 >= 100 - s), so the zero count for every start is a constant plus
+// a suffix sum over a histogram of the positions mod 100.
+static DialSummary summarize(const std::string_view rotations)
+{
+    // Positions are biased by a multiple of 100 so they stay non-negative and floor division is plain unsigned
+    // division. The bias cancels since every rotation adds one quotient and subtracts another.
+    std::array<uint64_t, 100> added_counts {};
+    std::array<uint64_t, 100> subtracted_counts {};
+    uint64_t added_quotients = 0;
+    uint64_t subtracted_quotients = 0;
+    uint64_t position = uint64_t(100) << 40;
+    for (size_t pos = 0; pos < rotations.length(); ++pos) {
+        const uint64_t next = position + parse_rotation(rotations, pos);
+        // Selects rather than branches: the direction is unpredictable.
+        const bool right = next > position;
+        const uint64_t added = right ? next : position - 1;
+        const uint64_t subtracted = right ? position : next - 1;
+        added_quotients += added / 100;
+        subtracted_quotients += subtracted / 100;
+        ++added_counts[added % 100];
+        ++subtracted_counts[subtracted % 100];
+        position = next;
+    }
+    std::array<int, 100> ends {};
+    std::array<uint64_t, 100> zero_counts {};
+    uint64_t zero_count = added_quotients - subtracted_quotients;
+    for (int start = 0; start < 100; ++start) {
+        if (start > 0) {
+            zero_count += added_counts[100 - start] - subtracted_counts[100 - start];
+        }
+        ends[start] = static_cast<int>((start + position) % 100);
+        zero_counts[start] = zero_count;
+    }
+    return { ends, zero_counts };
+}
+
+static uint64_t solve(const std::string_view data)
+{
+    const auto then = [](const DialSummary& first, const DialSummary& second) { return first.then(second); };
+    return parallel_scan(data, '\n', summarize, then).back().events(50);
+}
+
+const SolverRegistration registration { 1, 2, solve };
+
+}
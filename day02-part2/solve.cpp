@@ -0,0 +1,99 @@
+#include <parallel.hpp>
+#include <parse.hpp>
+#include <registry.hpp>
+#include <utils.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+
+namespace {
+
+struct Range {
+    uint64_t start;
+    uint64_t end;
+};
+
+// Sum of the numbers in range with `digits` digits that consist of one block of digits / times digits repeated
+// `times` times. Such a number is block * (1 + 10^k + 10^2k + ...), so the sum is an arithmetic series over the
+// blocks. Arithmetic wraps modulo 2^64, which is still exact for any total that fits.
+static uint64_t repeated_sum(const Range range, const int digits, const int times)
+{
+    const int block_digits = digits / times;
+    uint64_t multiplier = 0;
+    for (int i = 0; i < times; ++i) {
+        multiplier += ten_power(block_digits * i);
+    }
+    const uint64_t low = std::max(range.start, ten_power(digits - 1));
+    const uint64_t high
+        = std::min(range.end, digits == 20 ? std::numeric_limits<uint64_t>::max() : ten_power(digits) - 1);
+    if (low > high) {
+        return 0;
+    }
+    const uint64_t first = std::max(low / multiplier + (low % multiplier != 0 ? 1 : 0), ten_power(block_digits - 1));
+    const uint64_t last = std::min(high / multiplier, ten_power(block_digits) - 1);
+    if (first > last) {
+        return 0;
+    }
+    // Halve whichever factor is even before multiplying: when the count is odd, first + last is even.
+    const uint64_t count = last - first + 1;
+    const uint64_t block_sum = count % 2 == 0 ? count / 2 * (first + last) : (first + last) / 2 * count;
+    return block_sum * multiplier;
+}
+
+// Mobius function for the small divisors of a digit count.
+static int mobius(int value)
+{
+    int result = 1;
+    for (int prime = 2; prime * prime <= value; ++prime) {
+        if (value % prime == 0) {
+            value /= prime;
+            if (value % prime == 0) {
+                return 0;
+            }
+            result = -result;
+        }
+    }
+    return value > 1 ? -result : result;
+}
+
+// A number repeats a block of length digits / d for every d in a set of divisors exactly when it repeats the block for
+// their least common multiple, so inclusion-exclusion over the divisors d > 1 of the digit count counts every such
+// number once: the union is -sum(mobius(d) * S(d)).
+static uint64_t invalid_id_sum(const Range range)
+{
+    uint64_t sum = 0;
+    for (int digits = count_digits(range.start); digits <= count_digits(range.end); ++digits) {
+        for (int times = 2; times <= digits; ++times) {
+            if (digits % times != 0) {
+                continue;
+            }
+            const uint64_t times_sum = repeated_sum(range, digits, times);
+            switch (mobius(times)) {
+            case -1:
+                sum += times_sum;
+                break;
+            case 1:
+                sum -= times_sum;
+                break;
+            default:
+                break;
+            }
+        }
+    }
+    return sum;
+}
+
+static uint64_t solve(const std::string_view data)
+{
+    auto sum_ranges = [](const std::string_view ranges) {
+        uint64_t sum = 0;
+        for_each_record<Range, 2>(ranges, [&](const Range range) { sum += invalid_id_sum(range); });
+        return sum;
+    };
+    return parallel_reduce(data, ',', uint64_t { 0 }, sum_ranges, std::plus());
+}
+
+const SolverRegistration registration { 2, 2, solve };
+
+}
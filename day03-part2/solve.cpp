@@ -0,0 +1,30 @@
+#include <digit_selection.hpp>
+#include <parallel.hpp>
+#include <registry.hpp>
+
+#include <functional>
+
+namespace {
+
+static uint64_t sum_banks(const std::string_view banks)
+{
+    uint64_t sum = 0;
+    for (size_t pos = 0; pos < banks.size();) {
+        size_t end = banks.find('\n', pos);
+        if (end == std::string_view::npos) {
+            end = banks.size();
+        }
+        sum += max_digits<12>(banks.substr(pos, end - pos));
+        pos = end + 1;
+    }
+    return sum;
+}
+
+static uint64_t solve(const std::string_view data)
+{
+    return parallel_reduce(data, '\n', uint64_t { 0 }, sum_banks, std::plus());
+}
+
+const SolverRegistration registration { 3, 2, solve };
+
+}
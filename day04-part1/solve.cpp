@@ -0,0 +1,39 @@
+#include <bit_grid.hpp>
+#include <registry.hpp>
+#include <stencil.hpp>
+#include <utils.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <functional>
+
+namespace {
+
+static int count_accessible(const BitGrid& grid)
+{
+    const RowBands bands(grid.height(), grid.row_words() * sizeof(uint64_t));
+    std::vector<int> band_counts(bands.count());
+    for_each_band(bands, [&](const int band, const int begin, const int end) {
+        std::vector<uint64_t> crowded(grid.row_words());
+        int count = 0;
+        for (int y = begin; y < end; ++y) {
+            grid.neighbors_at_least_four(y, crowded.data());
+            const uint64_t* rolls = grid.row(y);
+            for (int w = 0; w < grid.row_words(); ++w) {
+                count += std::popcount(rolls[w] & ~crowded[w]);
+            }
+        }
+        band_counts[band] = count;
+    });
+    return std::ranges::fold_left(band_counts, 0, std::plus());
+}
+
+static int solve(const std::string_view data)
+{
+    const BitGrid grid = BitGrid::parse(data, '@');
+    return count_accessible(grid);
+}
+
+const SolverRegistration registration { 4, 1, solve };
+
+}
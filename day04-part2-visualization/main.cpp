@@ -1,126 +1,17 @@
+#include <mapped_file.hpp>
+#include <roll_removal.hpp>
 #include <utils.hpp>
 
 #include <raylib-cpp.hpp>
 
-#include <array>
-
 namespace rl = raylib;
 
-struct Vector2i {
-    int x;
-    int y;
-
-    Vector2i operator+(const Vector2i& other) const
-    {
-        return { x + other.x, y + other.y };
-    }
-
-    bool operator==(const Vector2i& other) const
-    {
-        return x == other.x && y == other.y;
-    }
-};
-
-struct Grid {
-    enum State : uint8_t { empty, roll };
-
-    int size {};
-    std::vector<State> data;
-
-    State& at(const Vector2i& pos)
-    {
-        return data[pos.x + size * pos.y];
-    }
-
-    [[nodiscard]] const State& at(const Vector2i& pos) const
-    {
-        return data[pos.x + size * pos.y];
-    }
-
-    [[nodiscard]] bool in_bounds(const Vector2i& pos) const
-    {
-        return pos.x >= 0 && pos.x < size && pos.y >= 0 && pos.y < size;
-    }
-};
-
-static Grid parse_grid(const std::string& data)
-{
-    std::optional<int> width;
-    std::vector<Grid::State> grid_data;
-    for (int pos = 0; pos < data.size(); ++pos) {
-        if (data[pos] == '\n' || pos >= data.size()) {
-            if (!width.has_value()) {
-                width = pos;
-            }
-        } else {
-            switch (data[pos]) {
-            case '.':
-                grid_data.push_back(Grid::State::empty);
-                break;
-            case '@':
-                grid_data.push_back(Grid::State::roll);
-                break;
-            default:
-                assert(false);
-            }
-        }
-    }
-    assert(width.has_value());
-    assert(grid_data.size() % *width == 0);
-    assert(grid_data.size() / *width == width);
-    return Grid { .size = *width, .data = std::move(grid_data) };
-}
-
-static bool accessible(const Grid& grid, const Vector2i& pos)
-{
-    assert(grid.in_bounds(pos));
-    assert(grid.at(pos) == Grid::State::roll);
-    constexpr std::array<Vector2i, 8> offsets {
-        { { -1, -1 }, { -1, 0 }, { -1, 1 }, { 0, -1 }, { 0, 1 }, { 1, -1 }, { 1, 0 }, { 1, 1 } }
-    };
-    uint8_t neighbor_count = 0;
-    for (const Vector2i& offset : offsets) {
-        if (const Vector2i neighbor = pos + offset;
-            grid.in_bounds(neighbor) && grid.at(neighbor) == Grid::State::roll) {
-            ++neighbor_count;
-        }
-    }
-    if (neighbor_count >= 4) {
-        return false;
-    }
-    return true;
-}
-
-static int remove_accessible_rolls(const Grid& grid, Grid& output)
-{
-    output.size = grid.size;
-    output.data.clear();
-    int removed = 0;
-    for (int y = 0; y < grid.size; ++y) {
-        for (int x = 0; x < grid.size; ++x) {
-            const Vector2i pos { x, y };
-            if (grid.at(pos) == Grid::State::empty) {
-                output.data.emplace_back(Grid::State::empty);
-                continue;
-            }
-            if (accessible(grid, pos)) {
-                output.data.emplace_back(Grid::State::empty);
-                ++removed;
-                continue;
-            }
-            output.data.emplace_back(Grid::State::roll);
-        }
-    }
-    assert(output.data.size() == output.size * output.size);
-    return removed;
-}
-
-static void update_grid_image(const Grid& grid, rl::Image& image)
+static void update_grid_image(const RollRemoval& removal, rl::Image& image)
 {
-    assert(image.GetWidth() == grid.size && image.GetHeight() == grid.size);
-    for (int y = 0; y < grid.size; ++y) {
-        for (int x = 0; x < grid.size; ++x) {
-            if (grid.at({ x, y }) == Grid::State::roll) {
+    assert(image.GetWidth() == removal.width() && image.GetHeight() == removal.height());
+    for (int y = 0; y < removal.height(); ++y) {
+        for (int x = 0; x < removal.width(); ++x) {
+            if (removal.roll(x, y)) {
                 image.DrawPixel(x, y, RED);
             } else {
                 rl::Color color = image.GetColor(x, y);
@@ -161,29 +52,29 @@ static void draw_grid(const rl::Window& window, const rl::Texture& grid_texture)
 
 int main()
 {
-    const std::string data = read_file("./day04-part2-visualization/input.txt");
+    const std::optional<MappedFile> input = MappedFile::open("./day04-part2-visualization/input.txt");
+    assert(input.has_value());
+    const std::string_view data = input->view();
     const rl::Window window(800, 800, "AOC 2025 | Day 4 Part 2", FLAG_WINDOW_RESIZABLE);
     SetTargetFPS(60);
 
-    Grid grid = parse_grid(data);
-    Grid grid_output;
-    rl::Image grid_image { grid.size, grid.size, BLACK };
-    update_grid_image(grid, grid_image);
+    RollRemoval removal(data, '@');
+    rl::Image grid_image { removal.width(), removal.height(), BLACK };
+    update_grid_image(removal, grid_image);
     rl::Texture grid_texture { grid_image };
     constexpr double step_seconds = 0.5;
     double next_time = GetTime() + step_seconds;
 
     auto update_grid = [&] {
-        remove_accessible_rolls(grid, grid_output);
-        std::swap(grid, grid_output);
-        update_grid_image(grid, grid_image);
+        removal.step();
+        update_grid_image(removal, grid_image);
         grid_texture.Update(grid_image.data);
         next_time = GetTime() + step_seconds;
     };
 
     auto reset_grid = [&] {
-        grid = parse_grid(data);
-        update_grid_image(grid, grid_image);
+        removal = RollRemoval(data, '@');
+        update_grid_image(removal, grid_image);
         grid_texture.Update(grid_image.data);
         next_time = GetTime() + step_seconds;
     };
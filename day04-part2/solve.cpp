@@ -0,0 +1,19 @@
+#include <registry.hpp>
+#include <roll_removal.hpp>
+#include <utils.hpp>
+
+namespace {
+
+static int solve(const std::string_view data)
+{
+    RollRemoval removal(data, '@');
+    int total_removed = 0;
+    while (!removal.done()) {
+        total_removed += removal.step();
+    }
+    return total_removed;
+}
+
+const SolverRegistration registration { 4, 2, solve };
+
+}
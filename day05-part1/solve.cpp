@@ -0,0 +1,25 @@
+#include <intervals.hpp>
+#include <parallel.hpp>
+#include <parse.hpp>
+#include <registry.hpp>
+
+#include <functional>
+
+namespace {
+
+static int solve(const std::string_view data)
+{
+    const size_t blank = data.find("\n\n");
+    assert(blank != std::string_view::npos);
+    const IntervalIndex index(parse_records<InclusiveRange, 2>(data.substr(0, blank)));
+    auto count_valid = [&](const std::string_view ids) {
+        int valid_count = 0;
+        for_each_uint<uint64_t>(ids, [&](const uint64_t id) { valid_count += index.contains(id); });
+        return valid_count;
+    };
+    return parallel_reduce(data.substr(blank), '\n', 0, count_valid, std::plus());
+}
+
+const SolverRegistration registration { 5, 1, solve };
+
+}
@@ -0,0 +1,21 @@
+#include <intervals.hpp>
+#include <parse.hpp>
+#include <registry.hpp>
+
+namespace {
+
+static uint64_t solve(const std::string_view data)
+{
+    const size_t blank = data.find("\n\n");
+    assert(blank != std::string_view::npos);
+    RangeUnionStream ranges;
+    for_each_record<InclusiveRange, 2>(
+        data.substr(0, blank), [&](const InclusiveRange& range) { ranges.add(range); });
+    uint64_t count = 0;
+    ranges.finish([&](const InclusiveRange& range) { count += range.end - range.start + 1; });
+    return count;
+}
+
+const SolverRegistration registration { 5, 2, solve };
+
+}
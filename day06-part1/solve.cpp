@@ -0,0 +1,28 @@
+#include <registry.hpp>
+#include <worksheet.hpp>
+
+namespace {
+
+// Each row of a problem holds one operand, read left to right across the problem's columns.
+static uint64_t solve(const std::string_view data)
+{
+    const Worksheet sheet = Worksheet::parse(data);
+    const std::vector<Worksheet::Problem>& problems = sheet.problems();
+    ProblemOperands operands(problems, sheet.rows());
+    for (size_t problem = 0; problem < problems.size(); ++problem) {
+        for (int y = 0; y < sheet.rows(); ++y) {
+            uint64_t value = 0;
+            for (int x = problems[problem].start; x < problems[problem].end; ++x) {
+                // Selects rather than branches: blanks pad numbers of any length on either side.
+                const uint64_t shifted = value * 10 + sheet.column(x)[y];
+                value = (sheet.digit_mask(x) >> y & 1) != 0 ? shifted : value;
+            }
+            operands.set(problem, y, value);
+        }
+    }
+    return operands.grand_total();
+}
+
+const SolverRegistration registration { 6, 1, solve };
+
+}
@@ -0,0 +1,34 @@
+#include <registry.hpp>
+#include <worksheet.hpp>
+
+#include <algorithm>
+#include <bit>
+
+namespace {
+
+// Each column of a problem holds one operand, read top to bottom from the column's contiguous digits.
+static uint64_t solve(const std::string_view data)
+{
+    const Worksheet sheet = Worksheet::parse(data);
+    const std::vector<Worksheet::Problem>& problems = sheet.problems();
+    int max_columns = 0;
+    for (const Worksheet::Problem& problem : problems) {
+        max_columns = std::max(max_columns, problem.end - problem.start);
+    }
+    ProblemOperands operands(problems, max_columns);
+    for (size_t problem = 0; problem < problems.size(); ++problem) {
+        for (int x = problems[problem].start; x < problems[problem].end; ++x) {
+            const uint8_t* digits = sheet.column(x);
+            uint64_t value = 0;
+            for (uint32_t mask = sheet.digit_mask(x); mask != 0; mask &= mask - 1) {
+                value = value * 10 + digits[std::countr_zero(mask)];
+            }
+            operands.set(problem, x - problems[problem].start, value);
+        }
+    }
+    return operands.grand_total();
+}
+
+const SolverRegistration registration { 6, 2, solve };
+
+}
@@ -0,0 +1,13 @@
+#include <beam_sweep.hpp>
+#include <registry.hpp>
+
+namespace {
+
+static uint64_t solve(const std::string_view data)
+{
+    return count_splits(SplitterRows::parse(data));
+}
+
+const SolverRegistration registration { 7, 1, solve };
+
+}
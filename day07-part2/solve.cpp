@@ -0,0 +1,13 @@
+#include <beam_sweep.hpp>
+#include <registry.hpp>
+
+namespace {
+
+static uint64_t solve(const std::string_view data)
+{
+    return sweep_beams(SplitterRows::parse(data)).timeline_count;
+}
+
+const SolverRegistration registration { 7, 2, solve };
+
+}
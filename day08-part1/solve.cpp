@@ -0,0 +1,52 @@
+#include <disjoint_set.hpp>
+#include <nearest_pairs.hpp>
+#include <parse.hpp>
+#include <registry.hpp>
+#include <utils.hpp>
+
+#include <algorithm>
+#include <functional>
+
+namespace {
+
+struct Vector3u64 {
+    uint64_t x { 0 };
+    uint64_t y { 0 };
+    uint64_t z { 0 };
+
+    [[nodiscard]] uint64_t operator[](const int axis) const
+    {
+        return axis == 0 ? x : axis == 1 ? y : z;
+    }
+};
+
+static DisjointSet create_circuits(
+    const std::vector<Vector3u64>& positions,
+    // ReSharper disable once CppDFAConstantParameter
+    const int max_connections)
+{
+    NearestPairStream<Vector3u64> pairs(positions);
+    DisjointSet circuits(positions.size());
+    for (int connection_count = 0; connection_count < max_connections; ++connection_count) {
+        const std::optional<PointPair> pair = pairs.next();
+        if (!pair.has_value()) {
+            break;
+        }
+        circuits.unite(pair->first, pair->second);
+    }
+    return circuits;
+}
+
+static uint64_t solve(const std::string_view data)
+{
+    const std::vector<Vector3u64> positions = parse_records<Vector3u64, 3>(data);
+    const DisjointSet circuits = create_circuits(positions, 1000);
+    std::vector<size_t> circuit_sizes = circuits.component_sizes();
+    assert(circuit_sizes.size() >= 3);
+    std::ranges::partial_sort(circuit_sizes, circuit_sizes.begin() + 3, std::greater {});
+    return circuit_sizes[0] * circuit_sizes[1] * circuit_sizes[2];
+}
+
+const SolverRegistration registration { 8, 1, solve };
+
+}
@@ -0,0 +1,44 @@
+#include <disjoint_set.hpp>
+#include <nearest_pairs.hpp>
+#include <parse.hpp>
+#include <registry.hpp>
+#include <utils.hpp>
+
+namespace {
+
+struct Vector3u64 {
+    uint64_t x { 0 };
+    uint64_t y { 0 };
+    uint64_t z { 0 };
+
+    [[nodiscard]] uint64_t operator[](const int axis) const
+    {
+        return axis == 0 ? x : axis == 1 ? y : z;
+    }
+};
+
+// Kruskal's algorithm over the pairs in distance order; the pair that joins the last two circuits is the longest
+// edge of the minimum spanning tree.
+static std::optional<PointPair> get_last_pair_to_fully_connect(const std::vector<Vector3u64>& positions)
+{
+    NearestPairStream<Vector3u64> pairs(positions);
+    DisjointSet circuits(positions.size());
+    while (const std::optional<PointPair> pair = pairs.next()) {
+        if (circuits.unite(pair->first, pair->second) && circuits.component_count() == 1) {
+            return pair;
+        }
+    }
+    return std::nullopt;
+}
+
+static uint64_t solve(const std::string_view data)
+{
+    const std::vector<Vector3u64> positions = parse_records<Vector3u64, 3>(data);
+    const std::optional<PointPair> last_pair = get_last_pair_to_fully_connect(positions);
+    assert(last_pair.has_value());
+    return positions[last_pair->first].x * positions[last_pair->second].x;
+}
+
+const SolverRegistration registration { 8, 2, solve };
+
+}
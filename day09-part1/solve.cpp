@@ -0,0 +1,110 @@
+#include <parse.hpp>
+#include <registry.hpp>
+#include <utils.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <ranges>
+
+namespace {
+
+struct Vector2i64 {
+    int64_t x;
+    int64_t y;
+};
+
+// Points not dominated towards the lower left: no other point has both a smaller or equal x and a smaller or equal y.
+// Sorted by increasing x, so y strictly decreases along the staircase.
+static std::vector<Vector2i64> lower_left_frontier(const std::vector<Vector2i64>& sorted)
+{
+    std::vector<Vector2i64> frontier;
+    for (const Vector2i64& point : sorted) {
+        if (frontier.empty() || point.y < frontier.back().y) {
+            frontier.push_back(point);
+        }
+    }
+    return frontier;
+}
+
+// Points not dominated towards the upper right, also sorted by increasing x with y strictly decreasing.
+static std::vector<Vector2i64> upper_right_frontier(const std::vector<Vector2i64>& sorted)
+{
+    std::vector<Vector2i64> frontier;
+    for (const Vector2i64& point : sorted | std::views::reverse) {
+        if (frontier.empty() || point.y > frontier.back().y) {
+            frontier.push_back(point);
+        }
+    }
+    std::ranges::reverse(frontier);
+    return frontier;
+}
+
+// Area of the tile rectangle with lower-left corner low and upper-right corner high. A pair the wrong way round on
+// one axis gives a negative value, which keeps the best partner monotone; the wrong way round on both is ruled out.
+static int64_t corner_area(const Vector2i64 low, const Vector2i64 high)
+{
+    const int64_t width = high.x - low.x + 1;
+    const int64_t height = high.y - low.y + 1;
+    if (width <= 0 && height <= 0) {
+        return std::numeric_limits<int64_t>::min();
+    }
+    return width * height;
+}
+
+// For lower corners in increasing x, the index of the best upper corner never decreases, so each level of the
+// recursion scans every upper corner at most once more than there are lower corners: O((L + U) log L) in total.
+static void search(
+    const std::vector<Vector2i64>& lows,
+    const std::vector<Vector2i64>& highs,
+    const size_t begin,
+    const size_t end,
+    const size_t high_begin,
+    const size_t high_end,
+    int64_t& best)
+{
+    if (begin >= end) {
+        return;
+    }
+    const size_t mid = begin + (end - begin) / 2;
+    size_t best_high = high_begin;
+    int64_t mid_best = std::numeric_limits<int64_t>::min();
+    for (size_t high = high_begin; high < high_end; ++high) {
+        if (const int64_t area = corner_area(lows[mid], highs[high]); area > mid_best) {
+            mid_best = area;
+            best_high = high;
+        }
+    }
+    best = std::max(best, mid_best);
+    search(lows, highs, begin, mid, high_begin, best_high + 1, best);
+    search(lows, highs, mid + 1, end, best_high, high_end, best);
+}
+
+// Largest rectangle with a red tile at its lower-left and upper-right corners. Only the two staircase frontiers can
+// hold the corners of the largest one, since moving a corner outwards never shrinks the rectangle.
+static int64_t max_diagonal_area(std::vector<Vector2i64> points)
+{
+    std::ranges::sort(points, [](const Vector2i64& a, const Vector2i64& b) {
+        return std::pair { a.x, a.y } < std::pair { b.x, b.y };
+    });
+    const std::vector<Vector2i64> lows = lower_left_frontier(points);
+    const std::vector<Vector2i64> highs = upper_right_frontier(points);
+    int64_t best = std::numeric_limits<int64_t>::min();
+    search(lows, highs, 0, lows.size(), 0, highs.size(), best);
+    return best;
+}
+
+static uint64_t solve(const std::string_view data)
+{
+    std::vector<Vector2i64> positions = parse_records<Vector2i64, 2>(data);
+    const int64_t rising = max_diagonal_area(positions);
+    // Mirroring y turns the upper-left to lower-right diagonal into the one above.
+    for (Vector2i64& position : positions) {
+        position.y = -position.y;
+    }
+    const int64_t falling = max_diagonal_area(positions);
+    return static_cast<uint64_t>(std::max(rising, falling));
+}
+
+const SolverRegistration registration { 9, 1, solve };
+
+}
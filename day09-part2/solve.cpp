@@ -0,0 +1,89 @@
+#include <compressed_grid.hpp>
+#include <parse.hpp>
+#include <registry.hpp>
+#include <thread_pool.hpp>
+#include <utils.hpp>
+
+#include <algorithm>
+#include <atomic>
+
+namespace {
+
+struct Vector2i64 {
+    int64_t x;
+    int64_t y;
+};
+
+// Inside cells of the compressed grid are counted in this type.
+using Count = uint32_t;
+
+// Below this many red tiles the pair loop is too short to be worth splitting across threads.
+constexpr size_t min_parallel_tiles = 4096;
+
+static uint64_t rect_area(const Vector2i64 first, const Vector2i64 second)
+{
+    const uint64_t width = std::abs(second.x - first.x) + 1;
+    const uint64_t height = std::abs(second.y - first.y) + 1;
+    return width * height;
+}
+
+static std::vector<int64_t> axis_values(const std::vector<Vector2i64>& positions, int64_t Vector2i64::* axis)
+{
+    std::vector<int64_t> values;
+    values.reserve(positions.size());
+    for (const Vector2i64& position : positions) {
+        values.push_back(position.*axis);
+    }
+    return values;
+}
+
+static uint64_t solve(const std::string_view data)
+{
+    const std::vector<Vector2i64> positions = parse_records<Vector2i64, 2>(data);
+    const CoordinateCompressor xs(axis_values(positions, &Vector2i64::x));
+    const CoordinateCompressor ys(axis_values(positions, &Vector2i64::y));
+    const std::vector<uint8_t> inside = rasterize_polygon(std::span<const Vector2i64>(positions), xs, ys);
+    const SummedAreaTable<Count> table(xs.cell_count(), ys.cell_count(), std::span<const uint8_t>(inside));
+    std::vector<std::pair<int, int>> compressed;
+    compressed.reserve(positions.size());
+    for (const Vector2i64& position : positions) {
+        compressed.emplace_back(xs.line(position.x), ys.line(position.y));
+    }
+    // A rectangle is valid when every compressed cell it covers is inside the polygon. The cell count is taken in the
+    // table's type so it cannot overflow int and wraps exactly like the sums do.
+    auto all_inside = [&](const int x0, const int y0, const int x1, const int y1) {
+        return table.sum(x0, y0, x1, y1) == static_cast<Count>(x1 - x0 + 1) * static_cast<Count>(y1 - y0 + 1);
+    };
+
+    // Workers take every workers-th first corner so the shrinking inner loops stay balanced.
+    std::atomic<uint64_t> max_area = 0;
+    auto search = [&](const unsigned int worker, const unsigned int workers) {
+        uint64_t local_max = 0;
+        for (size_t i = worker; i < positions.size(); i += workers) {
+            for (size_t j = i + 1; j < positions.size(); ++j) {
+                const uint64_t area = rect_area(positions[i], positions[j]);
+                if (area <= local_max) {
+                    continue;
+                }
+                const auto [xi, yi] = compressed[i];
+                const auto [xj, yj] = compressed[j];
+                if (all_inside(std::min(xi, xj), std::min(yi, yj), std::max(xi, xj), std::max(yi, yj))) {
+                    local_max = area;
+                }
+            }
+        }
+        uint64_t current = max_area.load(std::memory_order_relaxed);
+        while (local_max > current && !max_area.compare_exchange_weak(current, local_max)) { }
+    };
+    if (positions.size() < min_parallel_tiles) {
+        search(0, 1);
+    } else {
+        ThreadPool& pool = thread_pool();
+        pool.run([&](const unsigned int worker) { search(worker, pool.thread_count()); });
+    }
+    return max_area;
+}
+
+const SolverRegistration registration { 9, 2, solve };
+
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+// Splitter columns of a manifold in compressed sparse row form: the sorted columns of row y are
+// columns[row_starts[y], row_starts[y + 1]). Only splitters are stored, so memory and the work of anything walking the
+// rows grow with the number of splitters rather than the grid area.
+class SplitterRows {
+public:
+    static SplitterRows parse(const std::string_view data)
+    {
+        SplitterRows rows;
+        const size_t width = data.find('\n');
+        assert(width != std::string_view::npos);
+        rows.m_width = static_cast<uint32_t>(width);
+        rows.m_start = static_cast<uint32_t>(data.find('S'));
+        assert(rows.m_start < width);
+        rows.m_row_starts.push_back(0);
+        // find() skips the empty cells with memchr rather than a compare per cell.
+        for (size_t row = 0; row + width <= data.size(); row += width + 1) {
+            const std::string_view line = data.substr(row, width);
+            for (size_t x = line.find('^'); x != std::string_view::npos; x = line.find('^', x + 1)) {
+                assert(x > 0 && x + 1 < width);
+                assert(line[x + 1] != '^');
+                rows.m_columns.push_back(static_cast<uint32_t>(x));
+            }
+            rows.m_row_starts.push_back(static_cast<uint32_t>(rows.m_columns.size()));
+        }
+        return rows;
+    }
+
+    [[nodiscard]] uint32_t width() const
+    {
+        return m_width;
+    }
+
+    [[nodiscard]] uint32_t height() const
+    {
+        return static_cast<uint32_t>(m_row_starts.size() - 1);
+    }
+
+    // Column of the 'S' in the top row.
+    [[nodiscard]] uint32_t start() const
+    {
+        return m_start;
+    }
+
+    [[nodiscard]] std::span<const uint32_t> row(const uint32_t y) const
+    {
+        return std::span(m_columns).subspan(m_row_starts[y], m_row_starts[y + 1] - m_row_starts[y]);
+    }
+
+private:
+    uint32_t m_width = 0;
+    uint32_t m_start = 0;
+    std::vector<uint32_t> m_row_starts;
+    std::vector<uint32_t> m_columns;
+};
+
+struct BeamSweep {
+    // Splitters reached by at least one beam.
+    uint64_t split_count;
+    // Distinct paths from the start to the bottom row.
+    uint64_t timeline_count;
+};
+
+// Follows the beam from the start down the manifold one row at a time, keeping the number of timelines in each column.
+// A splitter moves its column's count to both neighbors, which are never splitters themselves, so each row is updated
+// in place. Only splitters are visited; memory is one counter per column and no recursion is involved.
+inline BeamSweep sweep_beams(const SplitterRows& rows)
+{
+    std::vector<uint64_t> timelines(rows.width(), 0);
+    timelines[rows.start()] = 1;
+    uint64_t split_count = 0;
+    for (uint32_t y = 1; y < rows.height(); ++y) {
+        for (const uint32_t x : rows.row(y)) {
+            if (const uint64_t count = timelines[x]; count != 0) {
+                ++split_count;
+                timelines[x - 1] += count;
+                timelines[x + 1] += count;
+                timelines[x] = 0;
+            }
+        }
+    }
+    uint64_t timeline_count = 0;
+    for (const uint64_t count : timelines) {
+        timeline_count += count;
+    }
+    return { split_count, timeline_count };
+}
+
+// Splitters reached by at least one beam, with the beams kept as one bit per column. A row only touches the words that
+// hold its splitters: the beams hitting them are hit = beams & splitters, and the row's beams become
+// (beams & ~hit) | hit << 1 | hit >> 1, with the bits shifted out of the word carried into its neighbors. Since
+// splitters are never adjacent, a carried bit never lands on a splitter of the same row.
+inline uint64_t count_splits(const SplitterRows& rows)
+{
+    // A zero guard word on either side takes the carries out of the first and last words.
+    std::vector<uint64_t> words((rows.width() + 63) / 64 + 2, 0);
+    uint64_t* beams = words.data() + 1;
+    beams[rows.start() / 64] |= uint64_t(1) << (rows.start() % 64);
+    uint64_t split_count = 0;
+    for (uint32_t y = 1; y < rows.height(); ++y) {
+        const std::span<const uint32_t> columns = rows.row(y);
+        for (size_t i = 0; i < columns.size();) {
+            const uint32_t word = columns[i] / 64;
+            uint64_t splitters = 0;
+            for (; i < columns.size() && columns[i] / 64 == word; ++i) {
+                splitters |= uint64_t(1) << (columns[i] % 64);
+            }
+            uint64_t* beam = beams + word;
+            const uint64_t hit = *beam & splitters;
+            split_count += std::popcount(hit);
+            *beam = (*beam & ~hit) | hit << 1 | hit >> 1;
+            beam[-1] |= hit << 63;
+            beam[1] |= hit >> 63;
+        }
+    }
+    return split_count;
+}
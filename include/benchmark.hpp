@@ -0,0 +1,234 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+struct BenchmarkOptions {
+    int warmup_runs = 10;
+    int min_runs = 10;
+    int max_runs = 1000000;
+    std::chrono::nanoseconds target_time = std::chrono::seconds(1);
+    bool perf_counters = true;
+    // Report heap allocations per run from allocation_count. Only meaningful in programs whose operator new counts.
+    bool count_allocations = false;
+};
+
+// Heap allocations made so far. The global operator new does not touch it; a program that wants allocation counts
+// replaces operator new with one that increments it, as the runner does.
+inline std::atomic<uint64_t> allocation_count = 0;
+
+struct PerfCounts {
+    double cycles;
+    double instructions;
+    double cache_misses;
+};
+
+struct BenchmarkResult {
+    std::string name;
+    size_t input_bytes;
+    int runs;
+    double min_ns;
+    double median_ns;
+    double mean_ns;
+    double p99_ns;
+    double max_ns;
+    double stddev_ns;
+    std::optional<double> allocations;
+    std::optional<PerfCounts> perf;
+};
+
+#ifdef __linux__
+// Cycles, instructions and cache misses read as one perf_event group. Opening fails when the kernel does not allow
+// user space counters (perf_event_paranoid) or in most containers, in which case no counts are reported.
+class PerfCounterGroup {
+public:
+    PerfCounterGroup()
+    {
+        m_fds[0] = open_counter(PERF_COUNT_HW_CPU_CYCLES, -1);
+        if (m_fds[0] < 0) {
+            return;
+        }
+        m_fds[1] = open_counter(PERF_COUNT_HW_INSTRUCTIONS, m_fds[0]);
+        m_fds[2] = open_counter(PERF_COUNT_HW_CACHE_MISSES, m_fds[0]);
+    }
+
+    PerfCounterGroup(const PerfCounterGroup&) = delete;
+
+    PerfCounterGroup& operator=(const PerfCounterGroup&) = delete;
+
+    ~PerfCounterGroup()
+    {
+        for (const int fd : m_fds) {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+    }
+
+    [[nodiscard]] bool valid() const
+    {
+        return std::ranges::all_of(m_fds, [](const int fd) { return fd >= 0; });
+    }
+
+    void start() const
+    {
+        ioctl(m_fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(m_fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+
+    [[nodiscard]] std::optional<PerfCounts> stop(const int runs) const
+    {
+        ioctl(m_fds[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+        struct {
+            uint64_t count;
+            uint64_t values[3];
+        } group {};
+        if (read(m_fds[0], &group, sizeof(group)) != sizeof(group) || group.count != 3) {
+            return std::nullopt;
+        }
+        return PerfCounts { .cycles = static_cast<double>(group.values[0]) / runs,
+                            .instructions = static_cast<double>(group.values[1]) / runs,
+                            .cache_misses = static_cast<double>(group.values[2]) / runs };
+    }
+
+private:
+    int m_fds[3] { -1, -1, -1 };
+
+    static int open_counter(const uint64_t config, const int group_fd)
+    {
+        perf_event_attr attr {};
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = config;
+        attr.disabled = group_fd == -1 ? 1 : 0;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP;
+        return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0));
+    }
+};
+#endif
+
+inline double percentile(const std::vector<double>& sorted, const double fraction)
+{
+    const auto index = static_cast<size_t>(std::ceil(fraction * static_cast<double>(sorted.size()))) - 1;
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+
+// Runs warmups, then picks the iteration count so that timing takes roughly options.target_time.
+template <typename Func>
+BenchmarkResult benchmark(
+    const std::string_view name, const size_t input_bytes, Func func, const BenchmarkOptions& options = {})
+{
+    using Clock = std::chrono::steady_clock;
+    const auto warmup_start = Clock::now();
+    for (int i = 0; i < options.warmup_runs; ++i) {
+        [[maybe_unused]] volatile auto result = std::invoke(func);
+    }
+    const double warmup_ns = std::chrono::duration<double, std::nano>(Clock::now() - warmup_start).count();
+    const double estimate_ns = std::max(warmup_ns / std::max(options.warmup_runs, 1), 1.0);
+    const int runs = static_cast<int>(std::clamp(
+        static_cast<double>(options.target_time.count()) / estimate_ns,
+        static_cast<double>(options.min_runs),
+        static_cast<double>(options.max_runs)));
+
+    std::vector<double> samples;
+    samples.reserve(runs);
+    std::optional<PerfCounts> perf;
+#ifdef __linux__
+    std::optional<PerfCounterGroup> counters;
+    if (options.perf_counters) {
+        counters.emplace();
+        if (!counters->valid()) {
+            counters.reset();
+        }
+    }
+    if (counters.has_value()) {
+        counters->start();
+    }
+#endif
+    const uint64_t allocations_before = allocation_count.load(std::memory_order_relaxed);
+    for (int i = 0; i < runs; ++i) {
+        const auto start = Clock::now();
+        [[maybe_unused]] volatile auto result = std::invoke(func);
+        const auto end = Clock::now();
+        samples.push_back(std::chrono::duration<double, std::nano>(end - start).count());
+    }
+    std::optional<double> allocations;
+    if (options.count_allocations) {
+        allocations = static_cast<double>(allocation_count.load(std::memory_order_relaxed) - allocations_before) / runs;
+    }
+#ifdef __linux__
+    if (counters.has_value()) {
+        perf = counters->stop(runs);
+    }
+#endif
+
+    std::ranges::sort(samples);
+    double sum = 0.0;
+    for (const double sample : samples) {
+        sum += sample;
+    }
+    const double mean = sum / runs;
+    double variance = 0.0;
+    for (const double sample : samples) {
+        variance += (sample - mean) * (sample - mean);
+    }
+    return BenchmarkResult { .name = std::string(name),
+                             .input_bytes = input_bytes,
+                             .runs = runs,
+                             .min_ns = samples.front(),
+                             .median_ns = percentile(samples, 0.5),
+                             .mean_ns = mean,
+                             .p99_ns = percentile(samples, 0.99),
+                             .max_ns = samples.back(),
+                             .stddev_ns = std::sqrt(variance / runs),
+                             .allocations = allocations,
+                             .perf = perf };
+}
+
+// One JSON object per line so results from different builds can be diffed or loaded with any JSON tool.
+inline std::string to_json(const BenchmarkResult& result)
+{
+    std::string json = std::format(
+        R"({{"name":"{}","input_bytes":{},"runs":{},"min_ns":{:.1f},"median_ns":{:.1f},"mean_ns":{:.1f},)"
+        R"("p99_ns":{:.1f},"max_ns":{:.1f},"stddev_ns":{:.1f},"bytes_per_ns":{:.4f})",
+        result.name,
+        result.input_bytes,
+        result.runs,
+        result.min_ns,
+        result.median_ns,
+        result.mean_ns,
+        result.p99_ns,
+        result.max_ns,
+        result.stddev_ns,
+        static_cast<double>(result.input_bytes) / result.median_ns);
+    if (result.allocations.has_value()) {
+        json += std::format(R"(,"allocations":{:.1f})", *result.allocations);
+    }
+    if (result.perf.has_value()) {
+        json += std::format(
+            R"(,"cycles":{:.0f},"instructions":{:.0f},"cache_misses":{:.0f})",
+            result.perf->cycles,
+            result.perf->instructions,
+            result.perf->cache_misses);
+    }
+    json += "}";
+    return json;
+}
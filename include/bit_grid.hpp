@@ -0,0 +1,119 @@
+#pragma once
+
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+// One bit per cell. Each row is padded to whole 64-bit words with a zero guard word on both sides, and there is a
+// zero guard row above and below, so neighbor words can be read without bounds checks. Bit x % 64 of word x / 64
+// holds column x.
+class BitGrid {
+public:
+    BitGrid(const int width, const int height)
+        : m_width(width)
+        , m_height(height)
+        , m_stride((width + 63) / 64 + 2)
+        , m_words(static_cast<size_t>(m_stride) * (height + 2), 0)
+    {
+    }
+
+    // Sets the cells marked with `filled`; every other character in a line is an unset cell.
+    static BitGrid parse(const std::string_view data, const char filled)
+    {
+        const size_t width = data.find('\n');
+        assert(width != std::string_view::npos);
+        const size_t height = (data.size() + width) / (width + 1);
+        BitGrid grid(static_cast<int>(width), static_cast<int>(height));
+        for (int y = 0; y < grid.m_height; ++y) {
+            const std::string_view line = data.substr(y * (width + 1), width);
+            assert(line.size() == width);
+            uint64_t* row = grid.row(y);
+            for (int x = 0; x < grid.m_width; ++x) {
+                row[x / 64] |= static_cast<uint64_t>(line[x] == filled) << (x % 64);
+            }
+        }
+        return grid;
+    }
+
+    [[nodiscard]] int width() const
+    {
+        return m_width;
+    }
+
+    [[nodiscard]] int height() const
+    {
+        return m_height;
+    }
+
+    // Words of the row without the guards; row(-1) and row(height) are the guard rows.
+    [[nodiscard]] int row_words() const
+    {
+        return m_stride - 2;
+    }
+
+    uint64_t* row(const int y)
+    {
+        return m_words.data() + static_cast<size_t>(y + 1) * m_stride + 1;
+    }
+
+    [[nodiscard]] const uint64_t* row(const int y) const
+    {
+        return m_words.data() + static_cast<size_t>(y + 1) * m_stride + 1;
+    }
+
+    [[nodiscard]] bool at(const int x, const int y) const
+    {
+        return (row(y)[x / 64] >> (x % 64) & 1) != 0;
+    }
+
+    [[nodiscard]] uint64_t count() const
+    {
+        uint64_t total = 0;
+        for (const uint64_t word : m_words) {
+            total += std::popcount(word);
+        }
+        return total;
+    }
+
+    // For every cell of row y, whether at least four of its eight neighbors are set. The eight shifted neighbor
+    // words are summed with bit-sliced full adders so each word handles 64 cells at once.
+    void neighbors_at_least_four(const int y, uint64_t* out) const
+    {
+        const uint64_t* above = row(y - 1);
+        const uint64_t* middle = row(y);
+        const uint64_t* below = row(y + 1);
+        for (int w = 0; w < row_words(); ++w) {
+            // Shifting left moves column x - 1 onto column x; shifting right moves column x + 1 onto column x.
+            const uint64_t inputs[8] { above[w] << 1 | above[w - 1] >> 63,  above[w],
+                                       above[w] >> 1 | above[w + 1] << 63,  middle[w] << 1 | middle[w - 1] >> 63,
+                                       middle[w] >> 1 | middle[w + 1] << 63, below[w] << 1 | below[w - 1] >> 63,
+                                       below[w],                             below[w] >> 1 | below[w + 1] << 63 };
+            const auto [ones_a, twos_a] = full_add(inputs[0], inputs[1], inputs[2]);
+            const auto [ones_b, twos_b] = full_add(inputs[3], inputs[4], inputs[5]);
+            const uint64_t ones_c = inputs[6] ^ inputs[7];
+            const uint64_t twos_c = inputs[6] & inputs[7];
+            const uint64_t twos_d = full_add(ones_a, ones_b, ones_c).carry;
+            // The count is at least four when at least two of the four weight-two carries are set.
+            const auto [twos_sum, twos_carry] = full_add(twos_a, twos_b, twos_c);
+            out[w] = twos_carry | (twos_sum & twos_d);
+        }
+    }
+
+private:
+    struct Sum {
+        uint64_t sum;
+        uint64_t carry;
+    };
+
+    int m_width;
+    int m_height;
+    int m_stride;
+    std::vector<uint64_t> m_words;
+
+    static Sum full_add(const uint64_t a, const uint64_t b, const uint64_t c)
+    {
+        return { a ^ b ^ c, (a & b) | (c & (a ^ b)) };
+    }
+};
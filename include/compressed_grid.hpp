@@ -0,0 +1,200 @@
+#pragma once
+
+#include <stencil.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// Distinct values of one axis, e.g. the x coordinates of polygon vertices, mapped to cells. Each value gets a line
+// cell, followed by a gap cell for the values strictly between it and the next one when there are any; values one
+// apart get no gap cell, since the gap would hold no tiles. All tiles in a gap behave the same for shapes built from
+// these values, so the compressed cells keep their topology and each cell stands for a nonempty set of tiles.
+class CoordinateCompressor {
+public:
+    explicit CoordinateCompressor(std::vector<int64_t> values)
+        : m_values(std::move(values))
+    {
+        std::ranges::sort(m_values);
+        const auto [first, last] = std::ranges::unique(m_values);
+        m_values.erase(first, last);
+        assert(!m_values.empty());
+        m_lines.reserve(m_values.size());
+        int cell = 0;
+        for (size_t i = 0; i < m_values.size(); ++i) {
+            m_lines.push_back(cell);
+            cell += i + 1 < m_values.size() && m_values[i + 1] - m_values[i] > 1 ? 2 : 1;
+        }
+    }
+
+    // Number of distinct values.
+    [[nodiscard]] int size() const
+    {
+        return static_cast<int>(m_values.size());
+    }
+
+    [[nodiscard]] int cell_count() const
+    {
+        return m_lines.back() + 1;
+    }
+
+    // Position of value among the distinct values; value must be one of them.
+    [[nodiscard]] int rank(const int64_t value) const
+    {
+        const auto it = std::ranges::lower_bound(m_values, value);
+        assert(it != m_values.end() && *it == value);
+        return static_cast<int>(it - m_values.begin());
+    }
+
+    // Cell of the line at the rank-th smallest value.
+    [[nodiscard]] int rank_line(const int rank) const
+    {
+        return m_lines[rank];
+    }
+
+    // Cell of the line at value, which must be one of the compressed values.
+    [[nodiscard]] int line(const int64_t value) const
+    {
+        return m_lines[rank(value)];
+    }
+
+    // Whether the line at the rank-th smallest value is followed by a gap cell.
+    [[nodiscard]] bool has_gap(const int rank) const
+    {
+        return rank + 1 < size() && m_lines[rank + 1] - m_lines[rank] == 2;
+    }
+
+    [[nodiscard]] int64_t value(const int line) const
+    {
+        const auto it = std::ranges::lower_bound(m_lines, line);
+        assert(it != m_lines.end() && *it == line);
+        return m_values[it - m_lines.begin()];
+    }
+
+private:
+    std::vector<int64_t> m_values;
+    std::vector<int> m_lines;
+};
+
+// Marks the compressed cells inside a rectilinear polygon or on its boundary, row-major with xs.cell_count() cells per
+// row. Vertices are given in order around the polygon and read with .x and .y. Between each pair of consecutive y
+// values, scanline parity over the vertical edges spanning them decides which columns are inside. That parity fills the
+// gap row between the two values and every cell of the upper line row that is not on the boundary. The last line row
+// has nothing inside but boundary.
+template <typename Point>
+std::vector<uint8_t> rasterize_polygon(
+    const std::span<const Point> vertices, const CoordinateCompressor& xs, const CoordinateCompressor& ys)
+{
+    const int width = xs.cell_count();
+    const int height = ys.cell_count();
+    auto index = [width](const int x, const int y) { return static_cast<size_t>(y) * width + x; };
+    std::vector<uint8_t> cells(static_cast<size_t>(width) * height, 0);
+    // Row r holds the vertical edges spanning the y values of ranks r and r + 1.
+    std::vector<uint8_t> crossings(static_cast<size_t>(width) * (ys.size() - 1), 0);
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        const Point& start = vertices[i];
+        const Point& end = vertices[(i + 1) % vertices.size()];
+        assert((start.x == end.x) != (start.y == end.y));
+        const int x0 = xs.line(std::min(start.x, end.x));
+        const int x1 = xs.line(std::max(start.x, end.x));
+        const int rank0 = ys.rank(std::min(start.y, end.y));
+        const int rank1 = ys.rank(std::max(start.y, end.y));
+        for (int y = ys.rank_line(rank0); y <= ys.rank_line(rank1); ++y) {
+            std::fill(cells.begin() + index(x0, y), cells.begin() + index(x1, y) + 1, 1);
+        }
+        if (x0 == x1) {
+            for (int rank = rank0; rank < rank1; ++rank) {
+                crossings[index(x0, rank)] = 1;
+            }
+        }
+    }
+    for (int rank = 0; rank + 1 < ys.size(); ++rank) {
+        const int line = ys.rank_line(rank);
+        const bool gap = ys.has_gap(rank);
+        uint8_t parity = 0;
+        for (int x = 0; x < width; ++x) {
+            parity ^= crossings[index(x, rank)];
+            cells[index(x, line)] |= parity;
+            if (gap) {
+                cells[index(x, line + 1)] |= parity;
+            }
+        }
+    }
+    return cells;
+}
+
+// Sums over any rectangle of a row-major grid with four lookups. The table has a leading row and column of zeros.
+// Construction runs on the thread pool by bands of rows: each band sums its own rows, the running totals of the bands
+// above are then carried down one row per band, and finally added to every row of each band in parallel.
+template <typename T>
+class SummedAreaTable {
+public:
+    template <typename Value>
+    SummedAreaTable(const int width, const int height, const std::span<const Value> values)
+        : m_width(width)
+        , m_height(height)
+        , m_sums(static_cast<size_t>(width + 1) * (height + 1), 0)
+    {
+        assert(values.size() == static_cast<size_t>(width) * height);
+        const RowBands bands(height, (width + 1) * sizeof(T));
+        for_each_band(bands, [&](int, const int begin, const int end) {
+            for (int y = begin; y < end; ++y) {
+                const Value* row = values.data() + static_cast<size_t>(y) * width;
+                T* sums = row_sums(y);
+                const T* above = y > begin ? row_sums(y - 1) : nullptr;
+                T row_sum = 0;
+                for (int x = 0; x < width; ++x) {
+                    row_sum += static_cast<T>(row[x]);
+                    sums[x + 1] = row_sum + (above != nullptr ? above[x + 1] : 0);
+                }
+            }
+        });
+        if (bands.count() == 1) {
+            return;
+        }
+        // carries[b] is the total of every row above band b, column by column.
+        std::vector<std::vector<T>> carries(bands.count(), std::vector<T>(width + 1, 0));
+        for (int band = 1; band < bands.count(); ++band) {
+            const T* last = row_sums(bands.end(band - 1) - 1);
+            for (int x = 0; x <= width; ++x) {
+                carries[band][x] = carries[band - 1][x] + last[x];
+            }
+        }
+        for_each_band(bands, [&](const int band, const int begin, const int end) {
+            const std::vector<T>& carry = carries[band];
+            for (int y = begin; band > 0 && y < end; ++y) {
+                T* sums = row_sums(y);
+                for (int x = 0; x <= width; ++x) {
+                    sums[x] += carry[x];
+                }
+            }
+        });
+    }
+
+    // Sum of the inclusive rectangle [x0, x1] x [y0, y1].
+    [[nodiscard]] T sum(const int x0, const int y0, const int x1, const int y1) const
+    {
+        assert(x0 <= x1 && y0 <= y1 && x1 < m_width && y1 < m_height);
+        const T* top = row_sums(y0 - 1);
+        const T* bottom = row_sums(y1);
+        return bottom[x1 + 1] - bottom[x0] - top[x1 + 1] + top[x0];
+    }
+
+private:
+    int m_width;
+    int m_height;
+    std::vector<T> m_sums;
+
+    // Sums up to and including row y; row_sums(-1) is the leading row of zeros.
+    T* row_sums(const int y)
+    {
+        return m_sums.data() + static_cast<size_t>(y + 1) * (m_width + 1);
+    }
+
+    [[nodiscard]] const T* row_sums(const int y) const
+    {
+        return m_sums.data() + static_cast<size_t>(y + 1) * (m_width + 1);
+    }
+};
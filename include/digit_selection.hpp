@@ -0,0 +1,102 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <string_view>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+// Largest K-digit number formed by digits of `digits` kept in their original order. One pass keeps the best choice so
+// far on a stack: each digit pops smaller digits off the top as long as enough digits remain to refill it. Works on the
+// ASCII bytes directly, since they order the same way as the digit values.
+template <int K>
+uint64_t max_digits_stack(const std::string_view digits)
+{
+    assert(digits.size() >= K);
+    std::array<char, K> stack {};
+    size_t size = 0;
+    for (size_t i = 0; i < digits.size(); ++i) {
+        const char digit = digits[i];
+        const size_t remaining = digits.size() - i;
+        while (size > 0 && stack[size - 1] < digit && size - 1 + remaining >= K) {
+            --size;
+        }
+        if (size < K) {
+            stack[size++] = digit;
+        }
+    }
+    uint64_t result = 0;
+    for (const char digit : stack) {
+        result = result * 10 + (digit - '0');
+    }
+    return result;
+}
+
+#if defined(__SSE2__) || defined(_M_X64)
+// Index of the first largest byte in data[begin, end). The maximum is found 16 bytes at a time with pmaxub, and a
+// second pass stops at the first block that contains it. A partial last block is loaded overlapping the one before.
+inline size_t first_max_index(const std::string_view data, const size_t begin, const size_t end)
+{
+    assert(begin < end && end <= data.size());
+    const auto load = [&](const size_t pos) {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data.data() + pos));
+    };
+    if (end - begin < 16) {
+        size_t max_index = begin;
+        for (size_t i = begin + 1; i < end; ++i) {
+            if (data[i] > data[max_index]) {
+                max_index = i;
+            }
+        }
+        return max_index;
+    }
+    __m128i max = load(end - 16);
+    for (size_t pos = begin; pos + 16 < end; pos += 16) {
+        max = _mm_max_epu8(max, load(pos));
+    }
+    max = _mm_max_epu8(max, _mm_srli_si128(max, 8));
+    max = _mm_max_epu8(max, _mm_srli_si128(max, 4));
+    max = _mm_max_epu8(max, _mm_srli_si128(max, 2));
+    max = _mm_max_epu8(max, _mm_srli_si128(max, 1));
+    max = _mm_set1_epi8(static_cast<char>(_mm_cvtsi128_si32(max)));
+    for (size_t pos = begin;; pos += 16) {
+        const size_t block = std::min(pos, end - 16);
+        if (const int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(load(block), max)); mask != 0) {
+            return block + std::countr_zero(static_cast<unsigned int>(mask));
+        }
+    }
+}
+
+// Same result as max_digits_stack: the i-th digit is the first largest digit that still leaves room for the rest,
+// found with a vector scan of the window. K scans of at most n bytes each beat the byte-serial stack, whose pops
+// mispredict, until K is a sizeable fraction of 16 times the cost of a stack step; on 100-digit banks the scans are
+// about ten times faster at K = 12.
+template <int K>
+uint64_t max_digits_simd(const std::string_view digits)
+{
+    assert(digits.size() >= K);
+    uint64_t result = 0;
+    size_t begin = 0;
+    for (int i = 0; i < K; ++i) {
+        const size_t index = first_max_index(digits, begin, digits.size() - K + i + 1);
+        result = result * 10 + (digits[index] - '0');
+        begin = index + 1;
+    }
+    return result;
+}
+#endif
+
+template <int K>
+uint64_t max_digits(const std::string_view digits)
+{
+#if defined(__SSE2__) || defined(_M_X64)
+    if constexpr (K <= 32) {
+        return max_digits_simd<K>(digits);
+    }
+#endif
+    return max_digits_stack<K>(digits);
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+// Union-find over the indices [0, size) with path compression and union by size.
+class DisjointSet {
+public:
+    explicit DisjointSet(const size_t size)
+        : m_parents(size)
+        , m_sizes(size, 1)
+        , m_component_count(size)
+    {
+        std::iota(m_parents.begin(), m_parents.end(), 0);
+    }
+
+    [[nodiscard]] size_t find(size_t index)
+    {
+        assert(index < m_parents.size());
+        size_t root = index;
+        while (m_parents[root] != root) {
+            root = m_parents[root];
+        }
+        while (m_parents[index] != root) {
+            index = std::exchange(m_parents[index], root);
+        }
+        return root;
+    }
+
+    // Returns false when both indices were already in the same set.
+    bool unite(const size_t first, const size_t second)
+    {
+        size_t first_root = find(first);
+        size_t second_root = find(second);
+        if (first_root == second_root) {
+            return false;
+        }
+        if (m_sizes[first_root] < m_sizes[second_root]) {
+            std::swap(first_root, second_root);
+        }
+        m_parents[second_root] = first_root;
+        m_sizes[first_root] += m_sizes[second_root];
+        --m_component_count;
+        return true;
+    }
+
+    [[nodiscard]] size_t set_size(const size_t index)
+    {
+        return m_sizes[find(index)];
+    }
+
+    [[nodiscard]] size_t component_count() const
+    {
+        return m_component_count;
+    }
+
+    [[nodiscard]] size_t size() const
+    {
+        return m_parents.size();
+    }
+
+    [[nodiscard]] std::vector<size_t> component_sizes() const
+    {
+        std::vector<size_t> sizes;
+        sizes.reserve(m_component_count);
+        for (size_t i = 0; i < m_parents.size(); ++i) {
+            if (m_parents[i] == i) {
+                sizes.push_back(m_sizes[i]);
+            }
+        }
+        return sizes;
+    }
+
+private:
+    std::vector<size_t> m_parents;
+    std::vector<size_t> m_sizes;
+    size_t m_component_count;
+};
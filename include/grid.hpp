@@ -0,0 +1,160 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <string_view>
+#include <vector>
+
+struct Vector2i {
+    int x;
+    int y;
+
+    bool operator==(const Vector2i& other) const = default;
+};
+
+// Hands out storage aligned to a cache line so grid rows can start on one.
+template <typename T>
+struct CacheAlignedAllocator {
+    using value_type = T;
+
+    static constexpr std::align_val_t alignment { 64 };
+
+    CacheAlignedAllocator() = default;
+
+    template <typename U>
+    explicit CacheAlignedAllocator(const CacheAlignedAllocator<U>&)
+    {
+    }
+
+    T* allocate(const size_t count)
+    {
+        return static_cast<T*>(::operator new(count * sizeof(T), alignment));
+    }
+
+    void deallocate(T* ptr, size_t)
+    {
+        ::operator delete(ptr, alignment);
+    }
+
+    bool operator==(const CacheAlignedAllocator&) const = default;
+};
+
+// Row-major grid surrounded by a halo of Pad sentinel cells on every side, so a stencil reaching up to Pad cells away
+// needs no bounds checks. Each row, halo included, starts on a cache line and the stride is a whole number of cache
+// lines. Cells are addressed by (x, y) with -Pad <= x < width + Pad and -Pad <= y < height + Pad, or by flat index into
+// data(), where moving by a neighbor offset steps to the neighboring cell.
+template <typename T, int Pad = 1>
+class Grid {
+public:
+    Grid(const int width, const int height, const T fill = T {}, const T border = T {})
+        : m_width(width)
+        , m_height(height)
+        , m_stride(aligned_stride(width))
+        , m_cells(static_cast<size_t>(m_stride) * (height + 2 * Pad), border)
+    {
+        for (int y = 0; y < height; ++y) {
+            std::fill(row(y), row(y) + width, fill);
+        }
+    }
+
+    // Converts each character of the lines of data with cell(c), writing straight into the padded buffer.
+    template <typename Func>
+    static Grid parse(const std::string_view data, Func cell, const T border = T {})
+    {
+        const size_t width = data.find('\n');
+        assert(width != std::string_view::npos);
+        const size_t height = (data.size() + width) / (width + 1);
+        Grid grid(static_cast<int>(width), static_cast<int>(height), border, border);
+        for (int y = 0; y < grid.m_height; ++y) {
+            const std::string_view line = data.substr(y * (width + 1), width);
+            assert(line.size() == width);
+            T* row = grid.row(y);
+            for (int x = 0; x < grid.m_width; ++x) {
+                row[x] = cell(line[x]);
+            }
+        }
+        return grid;
+    }
+
+    [[nodiscard]] int width() const
+    {
+        return m_width;
+    }
+
+    [[nodiscard]] int height() const
+    {
+        return m_height;
+    }
+
+    // Distance in cells between vertically neighboring cells.
+    [[nodiscard]] int stride() const
+    {
+        return m_stride;
+    }
+
+    // Pointer to cell (0, y); the halo cells of the row are at negative offsets and past width.
+    T* row(const int y)
+    {
+        return m_cells.data() + index({ 0, y });
+    }
+
+    [[nodiscard]] const T* row(const int y) const
+    {
+        return m_cells.data() + index({ 0, y });
+    }
+
+    T& operator[](const Vector2i pos)
+    {
+        return m_cells[index(pos)];
+    }
+
+    const T& operator[](const Vector2i pos) const
+    {
+        return m_cells[index(pos)];
+    }
+
+    T* data()
+    {
+        return m_cells.data();
+    }
+
+    [[nodiscard]] const T* data() const
+    {
+        return m_cells.data();
+    }
+
+    [[nodiscard]] size_t index(const Vector2i pos) const
+    {
+        assert(pos.x >= -Pad && pos.x < m_width + Pad && pos.y >= -Pad && pos.y < m_height + Pad);
+        return static_cast<size_t>(pos.y + Pad) * m_stride + Pad + pos.x;
+    }
+
+    [[nodiscard]] Vector2i position(const size_t index) const
+    {
+        return { static_cast<int>(index % m_stride) - Pad, static_cast<int>(index / m_stride) - Pad };
+    }
+
+    // Flat index offsets of the eight surrounding cells.
+    [[nodiscard]] std::array<ptrdiff_t, 8> neighbor_offsets() const
+    {
+        const ptrdiff_t stride = m_stride;
+        return { -stride - 1, -stride, -stride + 1, -1, 1, stride - 1, stride, stride + 1 };
+    }
+
+private:
+    static constexpr int cells_per_line = sizeof(T) >= 64 ? 1 : static_cast<int>(64 / sizeof(T));
+
+    int m_width;
+    int m_height;
+    int m_stride;
+    std::vector<T, CacheAlignedAllocator<T>> m_cells;
+
+    static int aligned_stride(const int width)
+    {
+        return (width + 2 * Pad + cells_per_line - 1) / cells_per_line * cells_per_line;
+    }
+};
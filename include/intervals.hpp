@@ -0,0 +1,320 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <queue>
+#include <span>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+struct InclusiveRange {
+    uint64_t start;
+    uint64_t end;
+
+    auto operator<=>(const InclusiveRange& other) const = default;
+};
+
+// LSD radix sort of the ranges by start, one byte per pass. The histograms of all eight bytes are built in a single
+// read, and passes where every start has the same byte (the high bytes, for most inputs) are skipped. Small inputs go
+// to std::sort, which wins below a few hundred elements.
+inline void radix_sort_by_start(std::vector<InclusiveRange>& ranges)
+{
+    constexpr size_t small_size = 256;
+    if (ranges.size() < small_size) {
+        std::ranges::sort(ranges, std::less(), &InclusiveRange::start);
+        return;
+    }
+    std::array<std::array<size_t, 256>, 8> counts {};
+    for (const InclusiveRange& range : ranges) {
+        for (int byte = 0; byte < 8; ++byte) {
+            ++counts[byte][range.start >> (byte * 8) & 0xff];
+        }
+    }
+    std::vector<InclusiveRange> buffer(ranges.size());
+    for (int byte = 0; byte < 8; ++byte) {
+        std::array<size_t, 256>& offsets = counts[byte];
+        if (std::ranges::find(offsets, ranges.size()) != offsets.end()) {
+            continue;
+        }
+        size_t offset = 0;
+        for (size_t& count : offsets) {
+            offset += std::exchange(count, offset);
+        }
+        for (const InclusiveRange& range : ranges) {
+            buffer[offsets[range.start >> (byte * 8) & 0xff]++] = range;
+        }
+        ranges.swap(buffer);
+    }
+}
+
+// Calls on_range with the union of ranges sorted by start, as disjoint ranges with gaps between them, in one pass.
+template <typename Range, typename Func>
+void unite_sorted_ranges(Range&& sorted, Func on_range)
+{
+    bool open = false;
+    InclusiveRange current {};
+    for (const InclusiveRange& range : sorted) {
+        // range.start > current.end in the second test, so the subtraction cannot wrap.
+        if (open && (range.start <= current.end || range.start - current.end == 1)) {
+            current.end = std::max(current.end, range.end);
+        } else {
+            if (open) {
+                on_range(current);
+            }
+            current = range;
+            open = true;
+        }
+    }
+    if (open) {
+        on_range(current);
+    }
+}
+
+// Sorts the ranges and merges the ones that overlap or touch, leaving sorted disjoint ranges with gaps between them.
+inline std::vector<InclusiveRange> merge_ranges(std::vector<InclusiveRange> ranges)
+{
+    radix_sort_by_start(ranges);
+    size_t merged = 0;
+    unite_sorted_ranges(ranges, [&](const InclusiveRange& range) { ranges[merged++] = range; });
+    ranges.resize(merged);
+    return ranges;
+}
+
+// Union of a stream of ranges that need not fit in memory. Ranges are buffered up to run_capacity; each full buffer
+// is sorted, merged and spilled to a temporary file as a sorted run, and finish() k-way merges the runs while uniting
+// them. When everything fits in one buffer nothing is written to disk. A failure to create, write or read back a run
+// throws std::system_error, since continuing would silently produce a wrong union.
+class RangeUnionStream {
+public:
+    static constexpr size_t default_run_capacity = size_t(1) << 22;
+
+    explicit RangeUnionStream(const size_t run_capacity = default_run_capacity)
+        : m_run_capacity(std::max<size_t>(run_capacity, 1))
+    {
+    }
+
+    void add(const InclusiveRange range)
+    {
+        m_buffer.push_back(range);
+        if (m_buffer.size() >= m_run_capacity) {
+            spill();
+        }
+    }
+
+    // Calls on_range with every range of the union in increasing order. The stream is empty afterwards.
+    template <typename Func>
+    void finish(Func on_range)
+    {
+        if (m_runs.empty()) {
+            radix_sort_by_start(m_buffer);
+            unite_sorted_ranges(m_buffer, on_range);
+            m_buffer.clear();
+            return;
+        }
+        if (!m_buffer.empty()) {
+            spill();
+        }
+        std::vector<RunReader> readers;
+        readers.reserve(m_runs.size());
+        for (File& run : m_runs) {
+            std::rewind(run.get());
+            readers.emplace_back(run.get());
+        }
+        HeadQueue heads;
+        for (size_t i = 0; i < readers.size(); ++i) {
+            if (const std::optional<InclusiveRange> range = readers[i].next(); range.has_value()) {
+                heads.emplace(*range, i);
+            }
+        }
+        unite_sorted_ranges(MergedRuns { heads, readers }, on_range);
+        m_runs.clear();
+    }
+
+private:
+    struct FileCloser {
+        void operator()(std::FILE* file) const
+        {
+            std::fclose(file);
+        }
+    };
+
+    using File = std::unique_ptr<std::FILE, FileCloser>;
+
+    // Reads a run back in blocks rather than one range per call.
+    class RunReader {
+    public:
+        explicit RunReader(std::FILE* file)
+            : m_file(file)
+            , m_block(block_size)
+        {
+        }
+
+        std::optional<InclusiveRange> next()
+        {
+            if (m_next == m_size) {
+                m_size = std::fread(m_block.data(), sizeof(InclusiveRange), m_block.size(), m_file);
+                m_next = 0;
+                if (m_size < m_block.size() && std::ferror(m_file) != 0) {
+                    fail("Failed to read back a spilled run of ranges");
+                }
+                if (m_size == 0) {
+                    return std::nullopt;
+                }
+            }
+            return m_block[m_next++];
+        }
+
+    private:
+        static constexpr size_t block_size = 4096;
+
+        std::FILE* m_file;
+        std::vector<InclusiveRange> m_block;
+        size_t m_next = 0;
+        size_t m_size = 0;
+    };
+
+    // The smallest unread range of each run, with the run it came from.
+    using Head = std::pair<InclusiveRange, size_t>;
+    using HeadQueue = std::priority_queue<Head, std::vector<Head>, std::greater<>>;
+
+    // Input range over the heads of all runs, smallest first.
+    struct MergedRuns {
+        HeadQueue& heads;
+        std::vector<RunReader>& readers;
+
+        struct Sentinel { };
+
+        struct Iterator {
+            MergedRuns* runs;
+
+            InclusiveRange operator*() const
+            {
+                return runs->heads.top().first;
+            }
+
+            Iterator& operator++()
+            {
+                const size_t run = runs->heads.top().second;
+                runs->heads.pop();
+                if (const std::optional<InclusiveRange> range = runs->readers[run].next(); range.has_value()) {
+                    runs->heads.emplace(*range, run);
+                }
+                return *this;
+            }
+
+            bool operator==(Sentinel) const
+            {
+                return runs->heads.empty();
+            }
+        };
+
+        Iterator begin()
+        {
+            return { this };
+        }
+
+        Sentinel end() const
+        {
+            return {};
+        }
+    };
+
+    size_t m_run_capacity;
+    std::vector<InclusiveRange> m_buffer;
+    std::vector<File> m_runs;
+
+    void spill()
+    {
+        const std::vector<InclusiveRange> merged = merge_ranges(std::move(m_buffer));
+        m_buffer.clear();
+        File file(std::tmpfile());
+        if (file == nullptr) {
+            fail("Failed to create a temporary file for a run of ranges");
+        }
+        if (std::fwrite(merged.data(), sizeof(InclusiveRange), merged.size(), file.get()) != merged.size()
+            || std::fflush(file.get()) != 0) {
+            fail("Failed to spill a run of ranges");
+        }
+        m_runs.push_back(std::move(file));
+    }
+
+    [[noreturn]] static void fail(const char* what)
+    {
+        throw std::system_error(errno, std::generic_category(), what);
+    }
+};
+
+// Membership index over a set of ranges. The merged ranges are kept both in sorted order, for batch queries that walk
+// them alongside sorted IDs, and in Eytzinger order (the BFS order of a complete binary search tree) for single
+// lookups: the first levels of the search share a few cache lines and the descent is a branchless index update.
+class IntervalIndex {
+public:
+    explicit IntervalIndex(std::vector<InclusiveRange> ranges)
+        : m_ranges(merge_ranges(std::move(ranges)))
+        , m_tree(m_ranges.size() + 1)
+    {
+        build(0, 1);
+    }
+
+    [[nodiscard]] const std::vector<InclusiveRange>& ranges() const
+    {
+        return m_ranges;
+    }
+
+    [[nodiscard]] bool contains(const uint64_t id) const
+    {
+        // Ends are sorted as well since the ranges are disjoint, so the candidate is the first range ending at or after
+        // id. The path taken is encoded in the bits of k; the trailing ones are the right turns made after the last
+        // left turn, which is where the answer was.
+        size_t k = 1;
+        while (k < m_tree.size()) {
+            k = 2 * k + (m_tree[k].end < id);
+        }
+        k >>= std::countr_one(k) + 1;
+        return k != 0 && m_tree[k].start <= id;
+    }
+
+    // Number of ids that fall in any range. The ids are sorted and walked together with the ranges, which beats
+    // separate lookups once there are about as many ids as ranges.
+    [[nodiscard]] size_t count_contained(std::span<uint64_t> ids) const
+    {
+        std::ranges::sort(ids);
+        size_t count = 0;
+        auto range = m_ranges.begin();
+        for (const uint64_t id : ids) {
+            while (range != m_ranges.end() && range->end < id) {
+                ++range;
+            }
+            if (range == m_ranges.end()) {
+                break;
+            }
+            count += range->start <= id;
+        }
+        return count;
+    }
+
+private:
+    std::vector<InclusiveRange> m_ranges;
+    // One-based; m_tree[0] is unused.
+    std::vector<InclusiveRange> m_tree;
+
+    // In-order traversal of the implicit tree assigns the sorted ranges to it.
+    size_t build(size_t sorted_index, const size_t k)
+    {
+        if (k < m_tree.size()) {
+            sorted_index = build(sorted_index, 2 * k);
+            m_tree[k] = m_ranges[sorted_index++];
+            sorted_index = build(sorted_index, 2 * k + 1);
+        }
+        return sorted_index;
+    }
+};
@@ -0,0 +1,157 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#include <string>
+#endif
+
+struct MapOptions {
+    // Fault in every page up front (MAP_POPULATE) so the solver does not pay for page faults.
+    bool populate = false;
+    // Ask for transparent huge pages. Only a hint; it has no effect when the kernel cannot back file pages with them.
+    bool huge_pages = false;
+};
+
+// Read-only view of a whole file with no copy on POSIX systems. At least `padding` zero bytes are readable past the
+// end of the view, so parsers may look at data[pos] one past the last character, or load a full word near the end,
+// without bounds checks.
+class MappedFile {
+public:
+    static constexpr size_t padding = 64;
+
+    static std::optional<MappedFile> open(const std::filesystem::path& path, const MapOptions options = {})
+    {
+#if defined(__unix__) || defined(__APPLE__)
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return std::nullopt;
+        }
+        struct stat file_stat {};
+        if (fstat(fd, &file_stat) != 0) {
+            ::close(fd);
+            return std::nullopt;
+        }
+        const auto size = static_cast<size_t>(file_stat.st_size);
+        const auto page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        const size_t mapping_size = (size + padding + page_size - 1) / page_size * page_size;
+        // Reserve zeroed pages for the file plus padding, then map the file over the front of them. The kernel zero
+        // fills the rest of the last file page, and the reserved pages cover the case of a page aligned file size.
+        void* base = mmap(nullptr, mapping_size, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base == MAP_FAILED) {
+            ::close(fd);
+            return std::nullopt;
+        }
+        if (size > 0) {
+            int flags = MAP_PRIVATE | MAP_FIXED;
+#ifdef MAP_POPULATE
+            if (options.populate) {
+                flags |= MAP_POPULATE;
+            }
+#endif
+            if (mmap(base, size, PROT_READ, flags, fd, 0) == MAP_FAILED) {
+                munmap(base, mapping_size);
+                ::close(fd);
+                return std::nullopt;
+            }
+#ifdef MADV_HUGEPAGE
+            if (options.huge_pages) {
+                madvise(base, size, MADV_HUGEPAGE);
+            }
+#endif
+        }
+        ::close(fd);
+        return MappedFile(static_cast<const char*>(base), size, mapping_size);
+#else
+        std::ifstream file { path, std::ios::binary | std::ios::ate };
+        if (!file) {
+            return std::nullopt;
+        }
+        const auto size = static_cast<size_t>(file.tellg());
+        std::string buffer(size + padding, '\0');
+        file.seekg(0);
+        file.read(buffer.data(), static_cast<std::streamsize>(size));
+        return MappedFile(std::move(buffer), size);
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+
+    MappedFile& operator=(const MappedFile&) = delete;
+
+#if defined(__unix__) || defined(__APPLE__)
+    MappedFile(MappedFile&& other) noexcept
+        : m_data(std::exchange(other.m_data, nullptr))
+        , m_size(std::exchange(other.m_size, 0))
+        , m_mapping_size(std::exchange(other.m_mapping_size, 0))
+    {
+    }
+
+    MappedFile& operator=(MappedFile&& other) noexcept
+    {
+        std::swap(m_data, other.m_data);
+        std::swap(m_size, other.m_size);
+        std::swap(m_mapping_size, other.m_mapping_size);
+        return *this;
+    }
+
+    ~MappedFile()
+    {
+        if (m_data != nullptr) {
+            munmap(const_cast<char*>(m_data), m_mapping_size);
+        }
+    }
+
+    [[nodiscard]] std::string_view view() const
+    {
+        return { m_data, m_size };
+    }
+#else
+    MappedFile(MappedFile&&) noexcept = default;
+
+    MappedFile& operator=(MappedFile&&) noexcept = default;
+
+    [[nodiscard]] std::string_view view() const
+    {
+        return { m_buffer.data(), m_size };
+    }
+#endif
+
+    [[nodiscard]] size_t size() const
+    {
+        return m_size;
+    }
+
+private:
+#if defined(__unix__) || defined(__APPLE__)
+    const char* m_data;
+    size_t m_size;
+    size_t m_mapping_size;
+
+    MappedFile(const char* data, const size_t size, const size_t mapping_size)
+        : m_data(data)
+        , m_size(size)
+        , m_mapping_size(mapping_size)
+    {
+    }
+#else
+    std::string m_buffer;
+    size_t m_size;
+
+    MappedFile(std::string buffer, const size_t size)
+        : m_buffer(std::move(buffer))
+        , m_size(size)
+    {
+    }
+#endif
+};
@@ -0,0 +1,226 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <queue>
+#include <span>
+#include <vector>
+
+// Squared Euclidean distance between points whose coordinates are read with point[axis].
+template <typename Point, int Dims>
+uint64_t point_distance_sqrd(const Point& first, const Point& second)
+{
+    uint64_t distance = 0;
+    for (int axis = 0; axis < Dims; ++axis) {
+        const uint64_t a = first[axis];
+        const uint64_t b = second[axis];
+        const uint64_t delta = a > b ? a - b : b - a;
+        distance += delta * delta;
+    }
+    return distance;
+}
+
+// Neighbor is packed to 12 bytes since neighbor lists are the bulk of the memory traffic when streaming pairs.
+// PointPair already fills 16 bytes without padding, so packing leaves it unchanged.
+#pragma pack(push, 4)
+struct Neighbor {
+    uint64_t distance_sqrd;
+    uint32_t index;
+
+    auto operator<=>(const Neighbor& other) const = default;
+};
+
+struct PointPair {
+    uint64_t distance_sqrd;
+    uint32_t first;
+    uint32_t second;
+
+    auto operator<=>(const PointPair& other) const = default;
+};
+#pragma pack(pop)
+
+static_assert(sizeof(Neighbor) == 12 && sizeof(PointPair) == 16);
+
+// Static k-d tree stored implicitly in a permutation of the point indices: the point at the middle of each subrange
+// splits it along the axis with the largest spread.
+template <typename Point, int Dims = 3>
+class KdTree {
+public:
+    explicit KdTree(const std::span<const Point> points)
+        : m_points(points)
+        , m_order(points.size())
+        , m_axes(points.size())
+    {
+        assert(points.size() <= std::numeric_limits<uint32_t>::max());
+        for (uint32_t i = 0; i < m_order.size(); ++i) {
+            m_order[i] = i;
+        }
+        build(0, m_order.size());
+    }
+
+    // Neighbors of points[index] ranked [skip, k) when ordered by distance and then by index, excluding the point
+    // itself. The ranking is total, so successive calls with growing k page through the same order. Only the
+    // requested page is sorted; the closer skipped neighbors are just partitioned off.
+    void nearest(const uint32_t index, const size_t skip, const size_t k, std::vector<Neighbor>& result) const
+    {
+        result.clear();
+        if (k == 0) {
+            return;
+        }
+        search(index, k, 0, m_order.size(), result);
+        if (skip >= result.size()) {
+            result.clear();
+            return;
+        }
+        std::ranges::nth_element(result, result.begin() + static_cast<std::ptrdiff_t>(skip));
+        result.erase(result.begin(), result.begin() + static_cast<std::ptrdiff_t>(skip));
+        std::ranges::sort(result);
+    }
+
+private:
+    std::span<const Point> m_points;
+    std::vector<uint32_t> m_order;
+    std::vector<uint8_t> m_axes;
+
+    void build(const size_t begin, const size_t end)
+    {
+        if (end - begin <= 1) {
+            return;
+        }
+        int split_axis = 0;
+        uint64_t max_spread = 0;
+        for (int axis = 0; axis < Dims; ++axis) {
+            const auto [min_it, max_it] = std::minmax_element(
+                m_order.begin() + begin, m_order.begin() + end, [&](const size_t a, const size_t b) {
+                    return m_points[a][axis] < m_points[b][axis];
+                });
+            if (const uint64_t spread = m_points[*max_it][axis] - m_points[*min_it][axis]; spread >= max_spread) {
+                max_spread = spread;
+                split_axis = axis;
+            }
+        }
+        const size_t mid = begin + (end - begin) / 2;
+        std::nth_element(
+            m_order.begin() + begin,
+            m_order.begin() + mid,
+            m_order.begin() + end,
+            [&](const uint32_t a, const uint32_t b) { return m_points[a][split_axis] < m_points[b][split_axis]; });
+        m_axes[mid] = static_cast<uint8_t>(split_axis);
+        build(begin, mid);
+        build(mid + 1, end);
+    }
+
+    // result is kept as a max-heap of the best k candidates found so far.
+    void search(
+        const uint32_t index, const size_t k, const size_t begin, const size_t end, std::vector<Neighbor>& result) const
+    {
+        if (begin >= end) {
+            return;
+        }
+        const size_t mid = begin + (end - begin) / 2;
+        const uint32_t candidate = m_order[mid];
+        if (candidate != index) {
+            const Neighbor neighbor { point_distance_sqrd<Point, Dims>(m_points[index], m_points[candidate]),
+                                      candidate };
+            if (result.size() < k) {
+                result.push_back(neighbor);
+                std::ranges::push_heap(result);
+            } else if (neighbor < result.front()) {
+                std::ranges::pop_heap(result);
+                result.back() = neighbor;
+                std::ranges::push_heap(result);
+            }
+        }
+        if (end - begin == 1) {
+            return;
+        }
+        const int axis = m_axes[mid];
+        const uint64_t target = m_points[index][axis];
+        const uint64_t split = m_points[candidate][axis];
+        const bool left_first = target < split;
+        if (left_first) {
+            search(index, k, begin, mid, result);
+        } else {
+            search(index, k, mid + 1, end, result);
+        }
+        const uint64_t plane_delta = target > split ? target - split : split - target;
+        if (result.size() < k || plane_delta * plane_delta <= result.front().distance_sqrd) {
+            if (left_first) {
+                search(index, k, mid + 1, end, result);
+            } else {
+                search(index, k, begin, mid, result);
+            }
+        }
+    }
+};
+
+// Yields every pair of distinct points in increasing distance order without materializing all N^2 / 2 pairs. Each
+// point lazily pages through its nearest neighbors from the k-d tree, doubling the page size when it runs out, and a
+// priority queue merges the per-point streams. Pair (i, j) with i < j is only produced by point i's stream.
+template <typename Point, int Dims = 3>
+class NearestPairStream {
+public:
+    explicit NearestPairStream(const std::span<const Point> points)
+        : m_tree(points)
+        , m_cursors(points.size())
+    {
+        for (uint32_t i = 0; i < points.size(); ++i) {
+            push_next(i);
+        }
+    }
+
+    std::optional<PointPair> next()
+    {
+        if (m_queue.empty()) {
+            return std::nullopt;
+        }
+        const PointPair pair = m_queue.top();
+        m_queue.pop();
+        ++m_cursors[pair.first].next;
+        push_next(pair.first);
+        return pair;
+    }
+
+private:
+    static constexpr size_t initial_neighbor_count = 8;
+
+    // Holds only the current page of neighbors, so memory stays proportional to the pairs in flight.
+    struct Cursor {
+        std::vector<Neighbor> neighbors;
+        size_t next = 0;
+        size_t fetched = 0;
+    };
+
+    KdTree<Point, Dims> m_tree;
+    std::vector<Cursor> m_cursors;
+    std::priority_queue<PointPair, std::vector<PointPair>, std::greater<>> m_queue;
+
+    void push_next(const uint32_t index)
+    {
+        Cursor& cursor = m_cursors[index];
+        const size_t max_neighbors = m_cursors.size() - 1;
+        while (true) {
+            if (cursor.next >= cursor.neighbors.size()) {
+                if (cursor.fetched >= max_neighbors) {
+                    return;
+                }
+                const size_t k = std::min(std::max(cursor.fetched * 2, initial_neighbor_count), max_neighbors);
+                m_tree.nearest(index, cursor.fetched, k, cursor.neighbors);
+                cursor.fetched = k;
+                cursor.next = 0;
+                assert(!cursor.neighbors.empty());
+            }
+            if (const Neighbor neighbor = cursor.neighbors[cursor.next]; neighbor.index > index) {
+                m_queue.push(PointPair { neighbor.distance_sqrd, index, neighbor.index });
+                return;
+            }
+            ++cursor.next;
+        }
+    }
+};
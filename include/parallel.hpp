@@ -0,0 +1,84 @@
+#pragma once
+
+#include <thread_pool.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+// Inputs smaller than this per worker are not worth waking the pool for.
+constexpr size_t min_parallel_chunk_bytes = size_t(64) * 1024;
+
+// Splits data into `count` chunks that each end just after a delimiter or at the end of data, so no record is cut.
+// Chunks are about the same size but may be empty when records are long.
+inline std::vector<std::string_view> split_chunks(const std::string_view data, const char delimiter, const size_t count)
+{
+    std::vector<std::string_view> chunks;
+    chunks.reserve(count);
+    size_t begin = 0;
+    for (size_t i = 1; i <= count; ++i) {
+        size_t end = data.size();
+        if (const size_t target = std::max(begin, data.size() * i / count); i < count && target < data.size()) {
+            const size_t delimiter_pos = data.find(delimiter, target);
+            end = delimiter_pos == std::string_view::npos ? data.size() : delimiter_pos + 1;
+        }
+        chunks.push_back(data.substr(begin, end - begin));
+        begin = end;
+    }
+    return chunks;
+}
+
+// Number of chunks to split data into: one per pool worker, but no more than the size justifies.
+inline size_t parallel_chunk_count(const std::string_view data)
+{
+    return std::clamp<size_t>(data.size() / min_parallel_chunk_bytes, 1, thread_pool().thread_count());
+}
+
+// Calls map(chunk) on chunks of data split at delimiters, in parallel, and folds the results into init in chunk order
+// with combine, so combine need only be associative. Small inputs are mapped as a single chunk on the calling thread.
+template <typename T, typename Map, typename Combine>
+T parallel_reduce(const std::string_view data, const char delimiter, T init, Map map, Combine combine)
+{
+    const size_t chunk_count = parallel_chunk_count(data);
+    if (chunk_count == 1) {
+        return combine(std::move(init), map(data));
+    }
+    const std::vector<std::string_view> chunks = split_chunks(data, delimiter, chunk_count);
+    std::vector<T> results(chunk_count);
+    thread_pool().run([&](const unsigned int worker) {
+        if (worker < chunk_count) {
+            results[worker] = map(chunks[worker]);
+        }
+    });
+    for (T& result : results) {
+        init = combine(std::move(init), std::move(result));
+    }
+    return init;
+}
+
+// For folds where each record depends on the state left by the ones before it. summarize(chunk) describes the effect
+// of a chunk independently of the state it starts in, and combine(a, b) is the effect of a followed by b, which must
+// be associative. Chunks are summarized in parallel and the summaries are composed in order; element i of the result
+// is the effect of chunks 0 to i, so the last one covers all of data.
+template <typename Summarize, typename Combine>
+auto parallel_scan(const std::string_view data, const char delimiter, Summarize summarize, Combine combine)
+{
+    using Summary = decltype(summarize(data));
+    const size_t chunk_count = parallel_chunk_count(data);
+    std::vector<Summary> summaries(chunk_count);
+    if (chunk_count == 1) {
+        summaries[0] = summarize(data);
+        return summaries;
+    }
+    const std::vector<std::string_view> chunks = split_chunks(data, delimiter, chunk_count);
+    thread_pool().run([&](const unsigned int worker) {
+        if (worker < chunk_count) {
+            summaries[worker] = summarize(chunks[worker]);
+        }
+    });
+    for (size_t i = 1; i < chunk_count; ++i) {
+        summaries[i] = combine(summaries[i - 1], summaries[i]);
+    }
+    return summaries;
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <utils.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+// Bit i is set when ptr[i] is an ASCII digit.
+inline uint64_t digit_mask_64(const char* ptr)
+{
+#if defined(__AVX2__)
+    const __m256i below = _mm256_set1_epi8('0' - 1);
+    const __m256i above = _mm256_set1_epi8('9' + 1);
+    auto mask_32 = [&](const char* p) {
+        const __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        const __m256i digits = _mm256_and_si256(_mm256_cmpgt_epi8(bytes, below), _mm256_cmpgt_epi8(above, bytes));
+        return static_cast<uint32_t>(_mm256_movemask_epi8(digits));
+    };
+    return mask_32(ptr) | static_cast<uint64_t>(mask_32(ptr + 32)) << 32;
+#elif defined(__SSE2__) || defined(_M_X64)
+    const __m128i below = _mm_set1_epi8('0' - 1);
+    const __m128i above = _mm_set1_epi8('9' + 1);
+    uint64_t mask = 0;
+    for (int i = 0; i < 4; ++i) {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + i * 16));
+        const __m128i digits = _mm_and_si128(_mm_cmpgt_epi8(bytes, below), _mm_cmpgt_epi8(above, bytes));
+        mask |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(digits))) << (i * 16);
+    }
+    return mask;
+#else
+    uint64_t mask = 0;
+    for (int i = 0; i < 64; ++i) {
+        mask |= static_cast<uint64_t>(is_digit(ptr[i])) << i;
+    }
+    return mask;
+#endif
+}
+
+// Calls func with every unsigned integer in data, in order, treating any non-digit as a separator. Digit masks are
+// built 64 bytes at a time so separators are skipped without touching them one by one, and each number is converted
+// eight digits at a time by parse_uint.
+template <typename UInt, typename Func>
+void for_each_uint(const std::string_view data, Func func)
+{
+    size_t block = 0;
+    size_t resume = 0;
+    uint64_t prev_top = 0;
+    for (; block + 64 <= data.size(); block += 64) {
+        const uint64_t mask = digit_mask_64(data.data() + block);
+        uint64_t starts = mask & ~(mask << 1 | prev_top);
+        prev_top = mask >> 63;
+        while (starts != 0) {
+            resume = block + std::countr_zero(starts);
+            starts &= starts - 1;
+            func(parse_uint<UInt>(data, resume));
+        }
+    }
+    for (size_t pos = std::max(block, resume); pos < data.size();) {
+        if (is_digit(data[pos])) {
+            func(parse_uint<UInt>(data, pos));
+        } else {
+            ++pos;
+        }
+    }
+}
+
+// Calls func with each consecutive group of Fields integers converted to a Record, e.g. "x,y,z" lines into 3D
+// positions, without allocating.
+template <typename Record, size_t Fields, typename UInt = uint64_t, typename Func>
+void for_each_record(const std::string_view data, Func func)
+{
+    std::array<UInt, Fields> fields {};
+    size_t field = 0;
+    for_each_uint<UInt>(data, [&](const UInt value) {
+        fields[field] = value;
+        if (++field == Fields) {
+            field = 0;
+            [&]<size_t... Is>(std::index_sequence<Is...>) {
+                func(Record(fields[Is]...));
+            }(std::make_index_sequence<Fields>());
+        }
+    });
+    assert(field == 0);
+}
+
+// Decodes consecutive groups of Fields integers into records, e.g. "x,y,z" lines into a vector of 3D positions.
+template <typename Record, size_t Fields, typename UInt = uint64_t>
+std::vector<Record> parse_records(const std::string_view data)
+{
+    std::vector<Record> records;
+    for_each_record<Record, Fields, UInt>(data, [&](const Record& record) { records.push_back(record); });
+    return records;
+}
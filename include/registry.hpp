@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct Solver {
+    int day;
+    int part;
+    std::function<uint64_t(std::string_view)> solve;
+
+    [[nodiscard]] std::string name() const
+    {
+        return std::format("day{:02}-part{}", day, part);
+    }
+
+    [[nodiscard]] std::filesystem::path input_path(const std::string_view file_name) const
+    {
+        return std::filesystem::path(".") / name() / file_name;
+    }
+};
+
+inline std::vector<Solver>& solver_registry()
+{
+    static std::vector<Solver> solvers;
+    return solvers;
+}
+
+// Each solution file declares one of these at namespace scope so linking it into the runner is enough to register it.
+struct SolverRegistration {
+    template <typename Func>
+    SolverRegistration(const int day, const int part, Func solve)
+    {
+        solver_registry().push_back(
+            Solver { .day = day,
+                     .part = part,
+                     .solve = [solve](const std::string_view data) { return static_cast<uint64_t>(solve(data)); } });
+    }
+};
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <grid.hpp>
+#include <stencil.hpp>
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+// Removes rolls with fewer than four neighboring rolls, one generation at a time, as if every generation were a
+// full-grid pass. Neighbor counts are kept per cell and only the neighbors of removed rolls are revisited, so the total
+// work is proportional to the number of removals rather than grid area times generations.
+class RollRemoval {
+public:
+    RollRemoval(const std::string_view data, const char roll)
+        : m_rolls(Grid<uint8_t>::parse(data, [roll](const char c) { return static_cast<uint8_t>(c == roll); }))
+        , m_counts(m_rolls.width(), m_rolls.height())
+    {
+        // Locals rather than members in the loops below, since stores through uint8_t may alias the members and would
+        // force them to be reloaded on every iteration.
+        const int width = m_rolls.width();
+        const Grid<uint8_t>& rolls = m_rolls;
+        Grid<uint8_t>& counts = m_counts;
+        // The halo of empty cells lets every neighbor be read without bounds checks. Each band of rows writes only its
+        // own counts, and its part of the first wave is concatenated in row order afterwards.
+        const RowBands bands(m_rolls.height(), m_rolls.stride());
+        std::vector<std::vector<uint32_t>> band_waves(bands.count());
+        for_each_band(bands, [&](const int band, const int begin, const int end) {
+            std::vector<uint32_t>& wave = band_waves[band];
+            for (int y = begin; y < end; ++y) {
+                const uint8_t* above = rolls.row(y - 1);
+                const uint8_t* middle = rolls.row(y);
+                const uint8_t* below = rolls.row(y + 1);
+                uint8_t* row_counts = counts.row(y);
+                for (int x = 0; x < width; ++x) {
+                    row_counts[x] = above[x - 1] + above[x] + above[x + 1] + middle[x - 1] + middle[x + 1]
+                        + below[x - 1] + below[x] + below[x + 1];
+                }
+                // Non-short-circuit test: holding a roll is close to random, but accessible rolls are rare.
+                const uint32_t row_index = static_cast<uint32_t>(rolls.index({ 0, y }));
+                for (int x = 0; x < width; ++x) {
+                    if ((middle[x] & (row_counts[x] < 4)) != 0) {
+                        wave.push_back(row_index + x);
+                    }
+                }
+            }
+        });
+        for (const std::vector<uint32_t>& wave : band_waves) {
+            m_wave.insert(m_wave.end(), wave.begin(), wave.end());
+        }
+    }
+
+    [[nodiscard]] int width() const
+    {
+        return m_rolls.width();
+    }
+
+    [[nodiscard]] int height() const
+    {
+        return m_rolls.height();
+    }
+
+    [[nodiscard]] bool roll(const int x, const int y) const
+    {
+        return m_rolls[{ x, y }] != 0;
+    }
+
+    [[nodiscard]] bool done() const
+    {
+        return m_wave.empty();
+    }
+
+    // Removes every roll that is accessible in the current generation, calling on_removed(x, y) for each, and returns
+    // how many were removed.
+    template <typename Func>
+    int step(Func on_removed)
+    {
+        m_removed.swap(m_wave);
+        m_wave.clear();
+        const std::array<ptrdiff_t, 8> offsets = m_rolls.neighbor_offsets();
+        uint8_t* rolls = m_rolls.data();
+        uint8_t* counts = m_counts.data();
+        for (const uint32_t cell : m_removed) {
+            rolls[cell] = 0;
+            const auto [x, y] = m_rolls.position(cell);
+            on_removed(x, y);
+        }
+        // Counts only decrease, so a roll crosses from four neighbors to three exactly once and is queued once. The
+        // append is branch-free because whether a neighbor crosses is unpredictable.
+        m_wave.resize(m_removed.size() * offsets.size());
+        uint32_t* wave = m_wave.data();
+        size_t wave_size = 0;
+        for (const uint32_t cell : m_removed) {
+            for (const ptrdiff_t offset : offsets) {
+                const uint32_t neighbor = static_cast<uint32_t>(cell + offset);
+                wave[wave_size] = neighbor;
+                wave_size += rolls[neighbor] & (--counts[neighbor] == 3);
+            }
+        }
+        m_wave.resize(wave_size);
+        return static_cast<int>(m_removed.size());
+    }
+
+    int step()
+    {
+        return step([](int, int) { });
+    }
+
+private:
+    Grid<uint8_t> m_rolls;
+    Grid<uint8_t> m_counts;
+    std::vector<uint32_t> m_wave;
+    std::vector<uint32_t> m_removed;
+};
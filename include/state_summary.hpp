@@ -0,0 +1,73 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <utility>
+
+// Effect of a segment of steps on a machine with States states: for every start state, the state it ends in and how
+// many events (e.g. visits to a particular state) happened along the way. Summaries compose associatively, so a long
+// sequence can be summarized in independent chunks and combined in order, and a summary of a live log stays current
+// by appending the summary of each new segment.
+template <int States>
+class StateSummary {
+public:
+    // The empty segment: every state stays put with no events.
+    StateSummary()
+    {
+        for (int state = 0; state < States; ++state) {
+            m_ends[state] = state;
+        }
+    }
+
+    StateSummary(const std::array<int, States>& ends, const std::array<uint64_t, States>& events)
+        : m_ends(ends)
+        , m_events(events)
+    {
+    }
+
+    [[nodiscard]] int end(const int start) const
+    {
+        assert(start >= 0 && start < States);
+        return m_ends[start];
+    }
+
+    [[nodiscard]] uint64_t events(const int start) const
+    {
+        assert(start >= 0 && start < States);
+        return m_events[start];
+    }
+
+    // This segment followed by next.
+    [[nodiscard]] StateSummary then(const StateSummary& next) const
+    {
+        StateSummary result;
+        for (int state = 0; state < States; ++state) {
+            const int middle = m_ends[state];
+            result.m_ends[state] = next.m_ends[middle];
+            result.m_events[state] = m_events[state] + next.m_events[middle];
+        }
+        return result;
+    }
+
+    void append(const StateSummary& next)
+    {
+        *this = then(next);
+    }
+
+    // Appends a single step given as step(state) -> std::pair(end state, events). This runs the step from every state;
+    // machines whose steps have structure, like a shift of the state, are better summarized directly.
+    template <typename Func>
+    void append_step(Func step)
+    {
+        for (int state = 0; state < States; ++state) {
+            const auto [end, events] = step(m_ends[state]);
+            m_ends[state] = end;
+            m_events[state] += events;
+        }
+    }
+
+private:
+    std::array<int, States> m_ends;
+    std::array<uint64_t, States> m_events {};
+};
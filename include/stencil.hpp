@@ -0,0 +1,66 @@
+#pragma once
+
+#include <thread_pool.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+
+// Rows [0, rows) of a 2D grid split into contiguous bands small enough to stay in cache while a stencil reads a band
+// and the halo rows on either side of it.
+class RowBands {
+public:
+    static constexpr size_t default_band_bytes = size_t(256) * 1024;
+
+    RowBands(const int rows, const size_t row_bytes, const size_t band_bytes = default_band_bytes)
+        : m_rows(rows)
+        , m_rows_per_band(static_cast<int>(std::max<size_t>(band_bytes / std::max<size_t>(row_bytes, 1), 1)))
+    {
+        assert(rows >= 0);
+    }
+
+    [[nodiscard]] int count() const
+    {
+        return std::max((m_rows + m_rows_per_band - 1) / m_rows_per_band, 1);
+    }
+
+    [[nodiscard]] int begin(const int band) const
+    {
+        return std::min(band * m_rows_per_band, m_rows);
+    }
+
+    [[nodiscard]] int end(const int band) const
+    {
+        return std::min((band + 1) * m_rows_per_band, m_rows);
+    }
+
+private:
+    int m_rows;
+    int m_rows_per_band;
+};
+
+// Calls func(band, begin_row, end_row) for every band on the shared thread pool and returns once all bands are done.
+// Each worker takes the same contiguous run of bands on every call, so a generation-synchronous stencil that calls
+// this once per generation, reading the previous generation and writing the next, keeps its rows in the same core's
+// cache and only shares the halo rows at band edges. A single band runs on the calling thread.
+template <typename Func>
+void for_each_band(const RowBands& bands, Func func)
+{
+    const int band_count = bands.count();
+    if (band_count == 1) {
+        func(0, bands.begin(0), bands.end(0));
+        return;
+    }
+    ThreadPool& pool = thread_pool();
+    const unsigned int workers = std::min<unsigned int>(pool.thread_count(), band_count);
+    pool.run([&](const unsigned int worker) {
+        if (worker >= workers) {
+            return;
+        }
+        const int first = static_cast<int>(static_cast<size_t>(band_count) * worker / workers);
+        const int last = static_cast<int>(static_cast<size_t>(band_count) * (worker + 1) / workers);
+        for (int band = first; band < last; ++band) {
+            func(band, bands.begin(band), bands.end(band));
+        }
+    });
+}
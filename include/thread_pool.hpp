@@ -0,0 +1,88 @@
+#pragma once
+
+#include <algorithm>
+#include <barrier>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed set of worker threads that run one task at a time. The calling thread takes part as worker 0, and each task is
+// one generation: the workers meet at a barrier to pick it up and again once all of them have finished it, so tasks
+// issued back to back see each other's writes without any further synchronization.
+class ThreadPool {
+public:
+    explicit ThreadPool(const unsigned int thread_count)
+        : m_thread_count(std::max(thread_count, 1u))
+        , m_barrier(m_thread_count)
+    {
+        m_workers.reserve(m_thread_count - 1);
+        for (unsigned int worker = 1; worker < m_thread_count; ++worker) {
+            m_workers.emplace_back([this, worker] { work(worker); });
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool()
+    {
+        if (m_thread_count > 1) {
+            m_stop = true;
+            m_barrier.arrive_and_wait();
+        }
+    }
+
+    [[nodiscard]] unsigned int thread_count() const
+    {
+        return m_thread_count;
+    }
+
+    // Calls task(worker) for every worker in [0, thread_count) and returns once all calls have finished. When the pool
+    // is already busy with a task from another thread, e.g. solvers running concurrently, the calls are made one after
+    // another on the calling thread instead. Tasks must not run the pool themselves.
+    template <typename Func>
+    void run(Func task)
+    {
+        const std::unique_lock lock(m_mutex, std::try_to_lock);
+        if (!lock.owns_lock() || m_thread_count == 1) {
+            for (unsigned int worker = 0; worker < m_thread_count; ++worker) {
+                task(worker);
+            }
+            return;
+        }
+        m_task = &task;
+        m_invoke = [](void* task, const unsigned int worker) { (*static_cast<Func*>(task))(worker); };
+        m_barrier.arrive_and_wait();
+        m_invoke(m_task, 0);
+        m_barrier.arrive_and_wait();
+    }
+
+private:
+    unsigned int m_thread_count;
+    std::barrier<> m_barrier;
+    std::mutex m_mutex;
+    bool m_stop = false;
+    void* m_task = nullptr;
+    void (*m_invoke)(void*, unsigned int) = nullptr;
+    // Declared last so the workers are joined before the barrier they wait on is destroyed.
+    std::vector<std::jthread> m_workers;
+
+    void work(const unsigned int worker)
+    {
+        while (true) {
+            m_barrier.arrive_and_wait();
+            if (m_stop) {
+                return;
+            }
+            m_invoke(m_task, worker);
+            m_barrier.arrive_and_wait();
+        }
+    }
+};
+
+// Shared pool with one worker per hardware thread.
+inline ThreadPool& thread_pool()
+{
+    static ThreadPool pool(std::thread::hardware_concurrency());
+    return pool;
+}
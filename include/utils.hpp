@@ -1,52 +1,17 @@
 #pragma once
 
 #include <cassert>
-#include <chrono>
 #include <cmath>
-#include <filesystem>
-#include <fstream>
-#include <functional>
-#include <print>
-#include <string>
-
-inline std::string read_file(const std::filesystem::path& path)
-{
-    const std::ifstream file { path };
-    std::stringstream ss;
-    ss << file.rdbuf();
-    return ss.str();
-}
-
-template <typename Func>
-void benchmark(Func func, const int runs)
-{
-    double time_running_total = 0.0;
-    for (int i = 0; i < runs; ++i) {
-        auto start = std::chrono::high_resolution_clock::now();
-        volatile auto result = std::invoke(func);
-        auto end = std::chrono::high_resolution_clock::now();
-        time_running_total += std::chrono::duration<double, std::nano>(end - start).count();
-    }
-    int avg_ns = static_cast<int>(std::round(time_running_total / runs));
-    std::println("Iterations: {}, Average ns: {}", runs, avg_ns);
-}
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
 
 inline bool is_digit(const char c)
 {
     return c >= '0' && c <= '9';
 }
 
-template <typename UInt>
-UInt parse_uint(const std::string& data, int& pos)
-{
-    UInt result = 0;
-    while (is_digit(data[pos])) {
-        result = result * 10 + (data[pos] - '0');
-        ++pos;
-    }
-    return result;
-}
-
 template <typename Int>
 constexpr Int math_mod(const Int dividend, const Int divisor)
 {
@@ -131,6 +96,51 @@ static uint64_t ten_power(const int exponent)
     }
 }
 
+// Number of ASCII digits at the start of eight bytes loaded little-endian.
+inline int leading_digit_count(const uint64_t chunk)
+{
+    // A byte is a digit when both its high nibble and the high nibble of byte + 6 are 3. Carries from adding 6 can
+    // only leave a non-digit byte, so they never affect the bytes before the first non-digit.
+    const uint64_t nibbles
+        = (chunk & 0xF0F0F0F0F0F0F0F0) | (((chunk + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4);
+    return std::countr_zero(nibbles ^ 0x3333333333333333) / 8;
+}
+
+// Converts eight ASCII digits, first digit in the lowest byte, with three multiplies instead of eight.
+inline uint64_t parse_eight_digits(uint64_t chunk)
+{
+    chunk = (chunk & 0x0F0F0F0F0F0F0F0F) * 2561 >> 8;
+    chunk = (chunk & 0x00FF00FF00FF00FF) * 6553601 >> 16;
+    return (chunk & 0x0000FFFF0000FFFF) * 42949672960001 >> 32;
+}
+
+template <typename UInt>
+UInt parse_uint(const std::string_view data, size_t& pos)
+{
+    UInt result = 0;
+    if constexpr (std::endian::native == std::endian::little) {
+        while (pos + 8 <= data.size()) {
+            uint64_t chunk;
+            std::memcpy(&chunk, data.data() + pos, sizeof(chunk));
+            const int digits = leading_digit_count(chunk);
+            if (digits == 0) {
+                return result;
+            }
+            // Shifting the digits to the top bytes turns the missing low bytes into leading zeros.
+            result = static_cast<UInt>(result * ten_power(digits) + parse_eight_digits(chunk << (64 - digits * 8)));
+            pos += digits;
+            if (digits < 8) {
+                return result;
+            }
+        }
+    }
+    while (pos < data.size() && is_digit(data[pos])) {
+        result = result * 10 + (data[pos] - '0');
+        ++pos;
+    }
+    return result;
+}
+
 inline size_t hash_combine(const size_t first, const size_t second)
 {
     // Based on Boost's hash_combine
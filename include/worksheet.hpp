@@ -0,0 +1,153 @@
+#pragma once
+
+#include <utils.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+// A worksheet of digit rows above a row of operators, transposed to column-major order: the digits of each character
+// column are contiguous, with blanks stored as 0, and a bitmask per column marks which rows hold digits. Problems are
+// the runs of columns that start at an operator.
+class Worksheet {
+public:
+    struct Problem {
+        int start;
+        int end;
+        bool multiply;
+    };
+
+    static Worksheet parse(const std::string_view data)
+    {
+        const size_t width = data.find('\n');
+        assert(width != std::string_view::npos);
+        size_t ops_start = data.find_last_not_of('\n');
+        assert(ops_start != std::string_view::npos);
+        ops_start = data.rfind('\n', ops_start) + 1;
+        const int rows = static_cast<int>(ops_start / (width + 1));
+        assert(rows > 0 && rows <= 32);
+        Worksheet sheet(static_cast<int>(width), rows);
+        // Column by column, so the transposed cells are written sequentially while the rows are read as a few
+        // sequential streams.
+        for (size_t x = 0; x < width; ++x) {
+            uint8_t* cells = sheet.m_cells.data() + x * rows;
+            uint32_t digit_mask = 0;
+            for (int y = 0; y < rows; ++y) {
+                const char c = data[y * (width + 1) + x];
+                const bool digit = is_digit(c);
+                assert(digit || c == ' ');
+                cells[y] = static_cast<uint8_t>(digit ? c - '0' : 0);
+                digit_mask |= static_cast<uint32_t>(digit) << y;
+            }
+            sheet.m_digit_masks[x] = digit_mask;
+        }
+        const std::string_view ops = data.substr(ops_start, data.find('\n', ops_start) - ops_start);
+        for (size_t x = 0; x < ops.size(); ++x) {
+            if (ops[x] == ' ') {
+                continue;
+            }
+            assert(ops[x] == '+' || ops[x] == '*');
+            if (!sheet.m_problems.empty()) {
+                // One blank column separates neighboring problems.
+                sheet.m_problems.back().end = static_cast<int>(x) - 1;
+            }
+            sheet.m_problems.push_back({ static_cast<int>(x), static_cast<int>(width), ops[x] == '*' });
+        }
+        return sheet;
+    }
+
+    [[nodiscard]] int width() const
+    {
+        return m_width;
+    }
+
+    [[nodiscard]] int rows() const
+    {
+        return m_rows;
+    }
+
+    // The rows() digits of column x, top to bottom.
+    [[nodiscard]] const uint8_t* column(const int x) const
+    {
+        return m_cells.data() + static_cast<size_t>(x) * m_rows;
+    }
+
+    // Bit y is set when row y of column x holds a digit.
+    [[nodiscard]] uint32_t digit_mask(const int x) const
+    {
+        return m_digit_masks[x];
+    }
+
+    [[nodiscard]] const std::vector<Problem>& problems() const
+    {
+        return m_problems;
+    }
+
+private:
+    int m_width;
+    int m_rows;
+    std::vector<uint8_t> m_cells;
+    std::vector<uint32_t> m_digit_masks;
+    std::vector<Problem> m_problems;
+
+    Worksheet(const int width, const int rows)
+        : m_width(width)
+        , m_rows(rows)
+        , m_cells(static_cast<size_t>(width) * rows, 0)
+        , m_digit_masks(width, 0)
+    {
+    }
+};
+
+// Operands of every problem stored operand-major: operand k of all problems is contiguous, and problems with fewer
+// operands are padded with the identity of their operation. The sums and products of all problems are then computed
+// together, one contiguous row of operands at a time, in loops the compiler vectorizes, and each problem picks its
+// result without a branch.
+class ProblemOperands {
+public:
+    ProblemOperands(const std::vector<Worksheet::Problem>& problems, const int operand_count)
+        : m_problem_count(problems.size())
+        , m_operand_count(operand_count)
+        , m_values(m_problem_count * operand_count)
+        , m_multiply(m_problem_count)
+    {
+        for (size_t problem = 0; problem < m_problem_count; ++problem) {
+            m_multiply[problem] = problems[problem].multiply;
+            for (int operand = 0; operand < operand_count; ++operand) {
+                m_values[operand * m_problem_count + problem] = problems[problem].multiply ? 1 : 0;
+            }
+        }
+    }
+
+    void set(const size_t problem, const int operand, const uint64_t value)
+    {
+        assert(problem < m_problem_count && operand < m_operand_count);
+        m_values[operand * m_problem_count + problem] = value;
+    }
+
+    [[nodiscard]] uint64_t grand_total() const
+    {
+        std::vector<uint64_t> sums(m_problem_count, 0);
+        std::vector<uint64_t> products(m_problem_count, 1);
+        for (int operand = 0; operand < m_operand_count; ++operand) {
+            const uint64_t* values = m_values.data() + operand * m_problem_count;
+            for (size_t problem = 0; problem < m_problem_count; ++problem) {
+                sums[problem] += values[problem];
+                products[problem] *= values[problem];
+            }
+        }
+        uint64_t total = 0;
+        for (size_t problem = 0; problem < m_problem_count; ++problem) {
+            total += m_multiply[problem] != 0 ? products[problem] : sums[problem];
+        }
+        return total;
+    }
+
+private:
+    size_t m_problem_count;
+    int m_operand_count;
+    std::vector<uint64_t> m_values;
+    std::vector<uint8_t> m_multiply;
+};
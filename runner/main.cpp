@@ -0,0 +1,229 @@
+#include <benchmark.hpp>
+#include <mapped_file.hpp>
+#include <registry.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <optional>
+#include <print>
+#include <span>
+#include <thread>
+
+// Counts every allocation for the benchmark's allocation report, including the over-aligned ones made for cache-aligned
+// grid storage.
+void* operator new(const size_t size)
+{
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    operator delete(ptr);
+}
+
+void* operator new(const size_t size, const std::align_val_t alignment)
+{
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    // aligned_alloc requires the size to be a multiple of the alignment.
+    const size_t align = static_cast<size_t>(alignment);
+    if (void* ptr = std::aligned_alloc(align, (std::max<size_t>(size, 1) + align - 1) / align * align)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t, const std::align_val_t alignment) noexcept
+{
+    operator delete(ptr, alignment);
+}
+
+struct Options {
+    bool parallel = false;
+    bool benchmark = false;
+    // File read from each solver's directory: input.txt, sample.txt with --sample, or any other with --input=FILE.
+    std::string_view input_file = "input.txt";
+    MapOptions map_options;
+    std::vector<const Solver*> solvers;
+};
+
+struct Run {
+    const Solver* solver;
+    MappedFile input;
+    uint64_t answer = 0;
+    std::chrono::nanoseconds time {};
+};
+
+static void print_usage()
+{
+    std::println(
+        stderr,
+        "Usage: aoc [--parallel] [--benchmark] [--sample | --input=FILE] [--populate] [--huge-pages] "
+        "[DAY | DAY.PART | dayNN-partM]...");
+    std::println(stderr, "Runs every registered solver when no days are given.");
+}
+
+static std::optional<int> parse_int(const std::string_view str)
+{
+    int value = 0;
+    if (const auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), value);
+        ec != std::errc {} || ptr != str.data() + str.size()) {
+        return std::nullopt;
+    }
+    return value;
+}
+
+// Accepts "3" for both parts of day 3, "3.2" for a single part, or the solver name "day03-part2".
+static bool select_solvers(const std::string_view selector, std::vector<const Solver*>& selected)
+{
+    std::optional<int> day;
+    std::optional<int> part;
+    if (selector.starts_with("day") && selector.size() == 11 && selector.substr(5, 5) == "-part") {
+        day = parse_int(selector.substr(3, 2));
+        part = parse_int(selector.substr(10, 1));
+        if (!part.has_value()) {
+            return false;
+        }
+    } else if (const size_t dot = selector.find('.'); dot != std::string_view::npos) {
+        day = parse_int(selector.substr(0, dot));
+        part = parse_int(selector.substr(dot + 1));
+        if (!part.has_value()) {
+            return false;
+        }
+    } else {
+        day = parse_int(selector);
+    }
+    if (!day.has_value()) {
+        return false;
+    }
+    bool found = false;
+    for (const Solver& solver : solver_registry()) {
+        if (solver.day == *day && (!part.has_value() || solver.part == *part)) {
+            selected.push_back(&solver);
+            found = true;
+        }
+    }
+    return found;
+}
+
+static std::optional<Options> parse_options(const std::span<char*> args)
+{
+    Options options;
+    for (const std::string_view arg : args) {
+        if (arg == "--parallel") {
+            options.parallel = true;
+        } else if (arg == "--benchmark") {
+            options.benchmark = true;
+        } else if (arg == "--sample") {
+            options.input_file = "sample.txt";
+        } else if (arg.starts_with("--input=")) {
+            options.input_file = arg.substr(8);
+        } else if (arg == "--populate") {
+            options.map_options.populate = true;
+        } else if (arg == "--huge-pages") {
+            options.map_options.huge_pages = true;
+        } else if (!select_solvers(arg, options.solvers)) {
+            std::println(stderr, "Unknown solver: {}", arg);
+            return std::nullopt;
+        }
+    }
+    if (options.solvers.empty()) {
+        for (const Solver& solver : solver_registry()) {
+            options.solvers.push_back(&solver);
+        }
+    }
+    std::ranges::sort(options.solvers, [](const Solver* a, const Solver* b) {
+        return std::pair { a->day, a->part } < std::pair { b->day, b->part };
+    });
+    const auto [first, last] = std::ranges::unique(options.solvers);
+    options.solvers.erase(first, last);
+    return options;
+}
+
+static void time_run(Run& run)
+{
+    const auto start = std::chrono::steady_clock::now();
+    run.answer = run.solver->solve(run.input.view());
+    run.time = std::chrono::steady_clock::now() - start;
+}
+
+static void time_runs_parallel(std::vector<Run>& runs)
+{
+    std::atomic<size_t> next = 0;
+    const unsigned int thread_count = std::min<size_t>(std::max(std::thread::hardware_concurrency(), 1u), runs.size());
+    std::vector<std::jthread> threads;
+    threads.reserve(thread_count);
+    for (unsigned int i = 0; i < thread_count; ++i) {
+        threads.emplace_back([&] {
+            for (size_t index = next++; index < runs.size(); index = next++) {
+                time_run(runs[index]);
+            }
+        });
+    }
+}
+
+int main(const int argc, char** argv)
+{
+    const std::optional<Options> options = parse_options({ argv + 1, argv + argc });
+    if (!options.has_value()) {
+        print_usage();
+        return 1;
+    }
+
+    std::vector<Run> runs;
+    runs.reserve(options->solvers.size());
+    for (const Solver* solver : options->solvers) {
+        const std::filesystem::path path = solver->input_path(options->input_file);
+        std::optional<MappedFile> input = MappedFile::open(path, options->map_options);
+        if (!input.has_value()) {
+            std::println(stderr, "Failed to open input: {}", path.string());
+            return 1;
+        }
+        runs.push_back(Run { .solver = solver, .input = std::move(*input) });
+    }
+
+    if (options->benchmark) {
+        for (const Run& run : runs) {
+            const BenchmarkResult result = benchmark(
+                run.solver->name(),
+                run.input.size(),
+                [&] { return run.solver->solve(run.input.view()); },
+                BenchmarkOptions { .count_allocations = true });
+            std::println("{}", to_json(result));
+        }
+        return 0;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    if (options->parallel) {
+        time_runs_parallel(runs);
+    } else {
+        std::ranges::for_each(runs, time_run);
+    }
+    const std::chrono::duration<double, std::micro> total = std::chrono::steady_clock::now() - start;
+
+    double solver_total_us = 0.0;
+    for (const Run& run : runs) {
+        const std::chrono::duration<double, std::micro> time = run.time;
+        solver_total_us += time.count();
+        std::println("{}: {:<20} {:>12.1f} us", run.solver->name(), run.answer, time.count());
+    }
+    std::println("total: {:.1f} us wall, {:.1f} us summed over solvers", total.count(), solver_total_us);
+}